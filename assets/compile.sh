@@ -1 +1,2 @@
 gcc ptf.c -lm -Ofast -o ptf
+gcc lod.c -lm -Ofast -o lod
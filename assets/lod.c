@@ -0,0 +1,307 @@
+/*
+    Decimated LOD chain for the rock meshes.
+
+    Reads the same ASCII .ply files as ptf (x,y,z,nx,ny,nz,r,g,b,a per
+    vertex, triangle faces), welds the flat shaded vertices back into a
+    closed mesh and collapses the cheapest edges by quadric error until
+    each LOD reaches its share of the original triangles.
+
+    Every LOD is written flat shaded and unindexed like ptf's output,
+    one face colour per triangle, as name_lodN_vertices, _normals,
+    _colors, _indices, _numind and _numvert in name_lod.h.
+
+    Compile: gcc lod.c -lm -Ofast -o lod
+    Usage: ./lod rock1 rock2 ... (reads ply/rockN.ply, writes rockN_lod.h)
+*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#define MAX_VERT 4096
+#define MAX_FACE 4096
+#define WELD 1e-4f
+#define LODS 2
+const float lod_ratio[LODS] = {0.5f, 0.25f}; // share of the original triangles
+
+typedef struct {float x,y,z;} v3;
+typedef struct {double q[10];} quadric;
+
+v3 pos[MAX_VERT];
+quadric vq[MAX_VERT];
+unsigned int numpos;
+
+unsigned int face[MAX_FACE][3];
+v3 fcol[MAX_FACE];
+unsigned int fdead[MAX_FACE];
+unsigned int numface, livefaces;
+
+static v3 sub(v3 a, v3 b){return (v3){a.x-b.x, a.y-b.y, a.z-b.z};}
+static v3 cross(v3 a, v3 b){return (v3){a.y*b.z-a.z*b.y, a.z*b.x-a.x*b.z, a.x*b.y-a.y*b.x};}
+static float dot(v3 a, v3 b){return a.x*b.x + a.y*b.y + a.z*b.z;}
+static v3 norm(v3 a)
+{
+    const float l = sqrtf(dot(a, a));
+    if(l == 0.f)
+        return a;
+    return (v3){a.x/l, a.y/l, a.z/l};
+}
+
+static v3 faceNormal(unsigned int a, unsigned int b, unsigned int c)
+{
+    return cross(sub(pos[b], pos[a]), sub(pos[c], pos[a]));
+}
+
+//*************************************
+// quadric error metric
+//*************************************
+static void qPlane(quadric* q, v3 n, float d)
+{
+    const double a=n.x, b=n.y, c=n.z, e=d;
+    const double p[10] = {a*a, a*b, a*c, a*e, b*b, b*c, b*e, c*c, c*e, e*e};
+    for(int i = 0; i < 10; i++)
+        q->q[i] += p[i];
+}
+
+static double qError(const quadric* q, v3 v)
+{
+    const double* m = q->q;
+    const double x=v.x, y=v.y, z=v.z;
+    return m[0]*x*x + 2*m[1]*x*y + 2*m[2]*x*z + 2*m[3]*x
+                    +   m[4]*y*y + 2*m[5]*y*z + 2*m[6]*y
+                                 +   m[7]*z*z + 2*m[8]*z
+                                              +   m[9];
+}
+
+static void buildQuadrics()
+{
+    memset(vq, 0, sizeof(vq));
+    for(unsigned int f = 0; f < numface; f++)
+    {
+        if(fdead[f] == 1)
+            continue;
+        const v3 n = norm(faceNormal(face[f][0], face[f][1], face[f][2]));
+        const float d = -dot(n, pos[face[f][0]]);
+        for(int k = 0; k < 3; k++)
+            qPlane(&vq[face[f][k]], n, d);
+    }
+}
+
+// 1 if moving a and b to p flips or collapses a face that survives
+static int collapseFlips(unsigned int a, unsigned int b, v3 p)
+{
+    for(unsigned int f = 0; f < numface; f++)
+    {
+        if(fdead[f] == 1)
+            continue;
+        int has_a = 0, has_b = 0;
+        for(int k = 0; k < 3; k++)
+        {
+            if(face[f][k] == a){has_a = 1;}
+            if(face[f][k] == b){has_b = 1;}
+        }
+        if((has_a ^ has_b) == 0)
+            continue; // untouched or removed by the collapse
+
+        v3 t[3];
+        for(int k = 0; k < 3; k++)
+            t[k] = (face[f][k] == a || face[f][k] == b) ? p : pos[face[f][k]];
+        const v3 before = faceNormal(face[f][0], face[f][1], face[f][2]);
+        const v3 after = cross(sub(t[1], t[0]), sub(t[2], t[0]));
+        if(dot(before, after) <= 0.f)
+            return 1;
+    }
+    return 0;
+}
+
+// collapses the cheapest edge, returns 0 if no edge can go
+static int collapseOne()
+{
+    double best = 1e30;
+    unsigned int ba=0, bb=0;
+    v3 bp = {0};
+    for(unsigned int f = 0; f < numface; f++)
+    {
+        if(fdead[f] == 1)
+            continue;
+        for(int k = 0; k < 3; k++)
+        {
+            const unsigned int a = face[f][k], b = face[f][(k+1)%3];
+            if(a > b)
+                continue; // every edge is seen from both of its faces
+            quadric q = vq[a];
+            for(int i = 0; i < 10; i++)
+                q.q[i] += vq[b].q[i];
+            const v3 cand[3] = {pos[a], pos[b], {(pos[a].x+pos[b].x)*0.5f, (pos[a].y+pos[b].y)*0.5f, (pos[a].z+pos[b].z)*0.5f}};
+            for(int c = 0; c < 3; c++)
+            {
+                const double e = qError(&q, cand[c]);
+                if(e < best && collapseFlips(a, b, cand[c]) == 0)
+                {
+                    best = e;
+                    ba = a, bb = b, bp = cand[c];
+                }
+            }
+        }
+    }
+    if(best == 1e30)
+        return 0;
+
+    pos[ba] = bp;
+    for(int i = 0; i < 10; i++)
+        vq[ba].q[i] += vq[bb].q[i];
+    for(unsigned int f = 0; f < numface; f++)
+    {
+        if(fdead[f] == 1)
+            continue;
+        for(int k = 0; k < 3; k++)
+            if(face[f][k] == bb)
+                face[f][k] = ba;
+        if(face[f][0] == face[f][1] || face[f][1] == face[f][2] || face[f][0] == face[f][2])
+        {
+            fdead[f] = 1;
+            livefaces--;
+        }
+    }
+    return 1;
+}
+
+//*************************************
+// ply in, header out
+//*************************************
+static unsigned int weld(v3 p)
+{
+    for(unsigned int i = 0; i < numpos; i++)
+        if(fabsf(pos[i].x-p.x) < WELD && fabsf(pos[i].y-p.y) < WELD && fabsf(pos[i].z-p.z) < WELD)
+            return i;
+    pos[numpos] = p;
+    return numpos++;
+}
+
+static int loadPLY(const char* file)
+{
+    FILE* f = fopen(file, "r");
+    if(f == NULL)
+        return 0;
+
+    static unsigned int remap[MAX_VERT];
+    static v3 vcol[MAX_VERT];
+    unsigned int numvert = 0, mode = 0;
+    numpos = 0, numface = 0;
+
+    char line[256];
+    while(fgets(line, 256, f) != NULL)
+    {
+        if(mode == 0)
+        {
+            if(strcmp(line, "end_header\n") == 0)
+                mode = 1;
+            continue;
+        }
+
+        float vx,vy,vz,nx,ny,nz,r,g,b;
+        unsigned int n,x,y,z;
+        if(mode == 1 && sscanf(line, "%f %f %f %f %f %f %f %f %f", &vx, &vy, &vz, &nx, &ny, &nz, &r, &g, &b) == 9 && numvert < MAX_VERT)
+        {
+            remap[numvert] = weld((v3){vx, vy, vz});
+            vcol[numvert] = (v3){0.003921568859f*r, 0.003921568859f*g, 0.003921568859f*b};
+            numvert++;
+        }
+        else if(sscanf(line, "%u %u %u %u", &n, &x, &y, &z) == 4 && n == 3 && numface < MAX_FACE)
+        {
+            mode = 2;
+            face[numface][0] = remap[x];
+            face[numface][1] = remap[y];
+            face[numface][2] = remap[z];
+            fcol[numface] = vcol[x];
+            fdead[numface] = 0;
+            numface++;
+        }
+    }
+    fclose(f);
+    livefaces = numface;
+    return numface > 0;
+}
+
+static void writeLOD(FILE* f, const char* name, unsigned int lod)
+{
+    fprintf(f, "const GLfloat %s_lod%u_vertices[] = {", name, lod);
+    unsigned int c = 0;
+    for(unsigned int i = 0; i < numface; i++)
+        if(fdead[i] == 0)
+            for(int k = 0; k < 3; k++, c++)
+                fprintf(f, "%s%g,%g,%g", c == 0 ? "" : ",", pos[face[i][k]].x, pos[face[i][k]].y, pos[face[i][k]].z);
+    fprintf(f, "};\nconst GLfloat %s_lod%u_normals[] = {", name, lod);
+    c = 0;
+    for(unsigned int i = 0; i < numface; i++)
+    {
+        if(fdead[i] == 1)
+            continue;
+        const v3 n = norm(faceNormal(face[i][0], face[i][1], face[i][2]));
+        for(int k = 0; k < 3; k++, c++)
+            fprintf(f, "%s%g,%g,%g", c == 0 ? "" : ",", n.x, n.y, n.z);
+    }
+    fprintf(f, "};\nconst GLfloat %s_lod%u_colors[] = {", name, lod);
+    c = 0;
+    for(unsigned int i = 0; i < numface; i++)
+        if(fdead[i] == 0)
+            for(int k = 0; k < 3; k++, c++)
+                fprintf(f, "%s%.3g,%.3g,%.3g", c == 0 ? "" : ",", fcol[i].x, fcol[i].y, fcol[i].z);
+    fprintf(f, "};\nconst GLushort %s_lod%u_indices[] = {", name, lod);
+    for(unsigned int i = 0; i < c; i++)
+        fprintf(f, "%s%u", i == 0 ? "" : ",", i);
+    fprintf(f, "};\nconst GLsizeiptr %s_lod%u_numind = %u;\nconst GLsizeiptr %s_lod%u_numvert = %u;\n", name, lod, c, name, lod, c);
+}
+
+int main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        printf("Please specify one or more input files.\n");
+        return 0;
+    }
+
+    for(int a = 1; a < argc; a++)
+    {
+        // take the input file name and strip any supplied extension
+        char name[32] = {0};
+        strncat(name, argv[a], 24);
+        char* p = strstr(name, ".");
+        if(p != NULL)
+            *p = 0x00;
+
+        char readfile[64];
+        sprintf(readfile, "ply/%s.ply", name);
+        printf("Open: %s\n", readfile);
+        if(loadPLY(readfile) == 0)
+        {
+            printf("Could not read: %s\n", readfile);
+            return 1;
+        }
+
+        char outfile[64];
+        sprintf(outfile, "%s_lod.h", name);
+        FILE* f = fopen(outfile, "w");
+        if(f == NULL)
+        {
+            printf("Could not write: %s\n", outfile);
+            return 1;
+        }
+        fprintf(f, "\n#ifndef %s_lod_H\n#define %s_lod_H\n\n", name, name);
+
+        // each LOD carries on collapsing from the one before it
+        const unsigned int source = numface;
+        buildQuadrics();
+        for(unsigned int l = 0; l < LODS; l++)
+        {
+            const unsigned int target = (unsigned int)(source * lod_ratio[l]);
+            while(livefaces > target && collapseOne() == 1){}
+            writeLOD(f, name, l+1);
+            printf("%s lod%u: %u -> %u triangles\n", name, l+1, source, livefaces);
+        }
+
+        fprintf(f, "\n#endif\n");
+        fclose(f);
+        printf("Output: %s\n", outfile);
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+
+#ifndef rock1_lod_H
+#define rock1_lod_H
+
+const GLfloat rock1_lod1_vertices[] = {0.181178,-0.948693,0.55762,-0.484628,-0.969268,-0.352099,0.180234,-0.943747,-0.554712,-0.391733,-0.242044,-0.745059,-0.484628,-0.969268,-0.352099,-0.905752,-0.559791,0,0.181178,-0.948693,0.55762,0.180234,-0.943747,-0.554712,0.726785,-0.555221,-0.528039,0.180234,-0.943747,-0.554712,-0.391733,-0.242044,-0.745059,-0.309604,0.500968,-0.952883,0.999188,0,0.32465,0.726785,-0.555221,-0.528039,1.10472,0,-0.358937,0.181178,-0.948693,0.55762,0.690026,-0.52714,0.501332,0,0,1.14716,0.180234,-0.943747,-0.554712,-0.309604,0.500968,-0.952883,0.687275,0,-0.945959,-0.46994,-0.456683,0.624246,-0.592564,0,0.815593,-0.990872,0,0.321949,-0.309604,0.500968,-0.952883,-0.897259,0.550226,-0.279661,-0.185542,0.971543,-0.571051,0.999188,0,0.32465,0.469521,0.939054,-0.341123,0.408542,0.817092,0.29682,-0.513955,0.515698,0.712174,0.26103,0.522061,0.803354,-0.530014,0.857584,0,-0.897259,0.550226,-0.279661,-0.513955,0.515698,0.712174,-0.530014,0.857584,0,-0.530014,0.857584,0,0.26103,0.522061,0.803354,0.408542,0.817092,0.29682,0.26103,0.522061,0.803354,0.999188,0,0.32465,0.408542,0.817092,0.29682,0.469521,0.939054,-0.341123,-0.185542,0.971543,-0.571051,0.408542,0.817092,0.29682,-0.185542,0.971543,-0.571051,-0.530014,0.857584,0,0.408542,0.817092,0.29682,-0.185542,0.971543,-0.571051,-0.897259,0.550226,-0.279661,-0.530014,0.857584,0,-0.990872,0,0.321949,-0.513955,0.515698,0.712174,-0.897259,0.550226,-0.279661,-0.990872,0,0.321949,-0.592564,0,0.815593,-0.513955,0.515698,0.712174,0,0,1.14716,0.26103,0.522061,0.803354,-0.513955,0.515698,0.712174,0,0,1.14716,0.999188,0,0.32465,0.26103,0.522061,0.803354,0.999188,0,0.32465,1.10472,0,-0.358937,0.469521,0.939054,-0.341123,0.687275,0,-0.945959,-0.185542,0.971543,-0.571051,0.469521,0.939054,-0.341123,0.687275,0,-0.945959,-0.309604,0.500968,-0.952883,-0.185542,0.971543,-0.571051,-0.391733,-0.242044,-0.745059,-0.897259,0.550226,-0.279661,-0.309604,0.500968,-0.952883,-0.391733,-0.242044,-0.745059,-0.905752,-0.559791,0,-0.897259,0.550226,-0.279661,-0.592564,0,0.815593,0,0,1.14716,-0.513955,0.515698,0.712174,-0.592564,0,0.815593,-0.46994,-0.456683,0.624246,0,0,1.14716,-0.46994,-0.456683,0.624246,0.181178,-0.948693,0.55762,0,0,1.14716,0,0,1.14716,0.690026,-0.52714,0.501332,0.999188,0,0.32465,1.10472,0,-0.358937,0.687275,0,-0.945959,0.469521,0.939054,-0.341123,1.10472,0,-0.358937,0.726785,-0.555221,-0.528039,0.687275,0,-0.945959,0.726785,-0.555221,-0.528039,0.180234,-0.943747,-0.554712,0.687275,0,-0.945959,-0.905752,-0.559791,0,-0.990872,0,0.321949,-0.897259,0.550226,-0.279661,-0.905752,-0.559791,0,-0.46994,-0.456683,0.624246,-0.990872,0,0.321949,0.181178,-0.948693,0.55762,0.726785,-0.555221,-0.528039,0.690026,-0.52714,0.501332,0.726785,-0.555221,-0.528039,0.999188,0,0.32465,0.690026,-0.52714,0.501332,-0.905752,-0.559791,0,-0.484628,-0.969268,-0.352099,-0.46994,-0.456683,0.624246,-0.484628,-0.969268,-0.352099,0.181178,-0.948693,0.55762,-0.46994,-0.456683,0.624246,0.180234,-0.943747,-0.554712,-0.484628,-0.969268,-0.352099,-0.391733,-0.242044,-0.745059};
+const GLfloat rock1_lod1_normals[] = {0.0369951,-0.999305,-0.00447482,0.0369951,-0.999305,-0.00447482,0.0369951,-0.999305,-0.00447482,-0.74886,-0.238465,-0.618339,-0.74886,-0.238465,-0.618339,-0.74886,-0.238465,-0.618339,0.579521,-0.814947,-0.00411549,0.579521,-0.814947,-0.00411549,0.579521,-0.814947,-0.00411549,-0.00878188,-0.268455,-0.963252,-0.00878188,-0.268455,-0.963252,-0.00878188,-0.268455,-0.963252,0.802344,-0.583868,0.123861,0.802344,-0.583868,0.123861,0.802344,-0.583868,0.123861,0.432312,-0.414937,0.800584,0.432312,-0.414937,0.800584,0.432312,-0.414937,0.800584,-0.148936,-0.309349,-0.939213,-0.148936,-0.309349,-0.939213,-0.148936,-0.309349,-0.939213,-0.703774,-0.426898,0.567856,-0.703774,-0.426898,0.567856,-0.703774,-0.426898,0.567856,-0.580523,0.599836,-0.550627,-0.580523,0.599836,-0.550627,-0.580523,0.599836,-0.550627,0.793162,0.579705,0.186644,0.793162,0.579705,0.186644,0.793162,0.579705,0.186644,-0.0583419,0.899453,0.433107,-0.0583419,0.899453,0.433107,-0.0583419,0.899453,0.433107,-0.737177,0.602509,0.305864,-0.737177,0.602509,0.305864,-0.737177,0.602509,0.305864,-0.112698,0.872529,0.475386,-0.112698,0.872529,0.475386,-0.112698,0.872529,0.475386,0.692216,0.51751,0.50301,0.692216,0.51751,0.50301,0.692216,0.51751,0.50301,-0.0166407,0.982368,0.186219,-0.0166407,0.982368,0.186219,-0.0166407,0.982368,0.186219,-0.016474,0.982391,0.186109,-0.016474,0.982391,0.186109,-0.016474,0.982391,0.186109,-0.552736,0.815698,-0.170643,-0.552736,0.815698,-0.170643,-0.552736,0.815698,-0.170643,-0.804254,0.495532,0.328062,-0.804254,0.495532,0.328062,-0.804254,0.495532,0.328062,-0.755973,0.237561,0.609975,-0.755973,0.237561,0.609975,-0.755973,0.237561,0.609975,-0.0997644,0.581566,0.807359,-0.0997644,0.581566,0.807359,-0.0997644,0.581566,0.807359,0.624297,0.187296,0.758402,0.624297,0.187296,0.758402,0.624297,0.187296,0.758402,0.822712,0.554089,0.127005,0.822712,0.554089,0.127005,0.822712,0.554089,0.127005,0.298114,0.56477,-0.769521,0.298114,0.56477,-0.769521,0.298114,0.56477,-0.769521,0.285503,0.557349,-0.779648,0.285503,0.557349,-0.779648,0.285503,0.557349,-0.779648,-0.753251,-0.0986296,-0.650296,-0.753251,-0.0986296,-0.650296,-0.753251,-0.0986296,-0.650296,-0.784108,-0.145976,-0.603213,-0.784108,-0.145976,-0.603213,-0.784108,-0.145976,-0.603213,-0.47378,0.242026,0.846732,-0.47378,0.242026,0.846732,-0.47378,0.242026,0.846732,-0.437312,-0.444889,0.781557,-0.437312,-0.444889,0.781557,-0.437312,-0.444889,0.781557,-0.331221,-0.542842,0.771761,-0.331221,-0.542842,0.771761,-0.331221,-0.542842,0.771761,0.631456,-0.113233,0.767099,0.631456,-0.113233,0.767099,0.631456,-0.113233,0.767099,0.710371,0.490092,-0.505156,0.710371,0.490092,-0.505156,0.710371,0.490092,-0.505156,0.762254,-0.353764,-0.542051,0.762254,-0.353764,-0.542051,0.762254,-0.353764,-0.542051,0.412247,-0.528997,-0.741764,0.412247,-0.528997,-0.741764,0.412247,-0.528997,-0.741764,-0.981067,-0.0402229,-0.189446,-0.981067,-0.0402229,-0.189446,-0.981067,-0.0402229,-0.189446,-0.704849,-0.431142,0.563297,-0.704849,-0.431142,0.563297,-0.704849,-0.431142,0.563297,0.640216,-0.766946,0.0437843,0.640216,-0.766946,0.0437843,0.640216,-0.766946,0.0437843,0.868173,-0.494264,0.044486,0.868173,-0.494264,0.044486,0.868173,-0.494264,0.044486,-0.421548,-0.800258,0.42648,-0.421548,-0.800258,0.42648,-0.421548,-0.800258,0.42648,-0.525598,-0.749956,0.401637,-0.525598,-0.749956,0.401637,-0.525598,-0.749956,0.401637,-0.246977,-0.436057,-0.865365,-0.246977,-0.436057,-0.865365,-0.246977,-0.436057,-0.865365};
+const GLfloat rock1_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock1_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock1_lod1_numind = 120;
+const GLsizeiptr rock1_lod1_numvert = 120;
+const GLfloat rock1_lod2_vertices[] = {0.181178,-0.948693,0.55762,-0.484628,-0.969268,-0.352099,0.45351,-0.749484,-0.541376,0.45351,-0.749484,-0.541376,-0.484628,-0.969268,-0.352099,-0.309604,0.500968,-0.952883,0.999188,0,0.32465,0.45351,-0.749484,-0.541376,0.895995,0,-0.652448,0.181178,-0.948693,0.55762,0.999188,0,0.32465,0,0,1.14716,0.45351,-0.749484,-0.541376,-0.309604,0.500968,-0.952883,0.895995,0,-0.652448,0.181178,-0.948693,0.55762,0,0,1.14716,-0.948312,-0.279896,0.160975,-0.309604,0.500968,-0.952883,-0.897259,0.550226,-0.279661,-0.185542,0.971543,-0.571051,0.999188,0,0.32465,0.469521,0.939054,-0.341123,0.334786,0.669577,0.550087,0,0,1.14716,0.334786,0.669577,0.550087,-0.185542,0.971543,-0.571051,-0.897259,0.550226,-0.279661,0,0,1.14716,-0.185542,0.971543,-0.571051,0.469521,0.939054,-0.341123,-0.185542,0.971543,-0.571051,0.334786,0.669577,0.550087,-0.948312,-0.279896,0.160975,0,0,1.14716,-0.897259,0.550226,-0.279661,0,0,1.14716,0.999188,0,0.32465,0.334786,0.669577,0.550087,0.999188,0,0.32465,0.895995,0,-0.652448,0.469521,0.939054,-0.341123,0.895995,0,-0.652448,-0.185542,0.971543,-0.571051,0.469521,0.939054,-0.341123,0.895995,0,-0.652448,-0.309604,0.500968,-0.952883,-0.185542,0.971543,-0.571051,-0.484628,-0.969268,-0.352099,-0.897259,0.550226,-0.279661,-0.309604,0.500968,-0.952883,-0.484628,-0.969268,-0.352099,-0.948312,-0.279896,0.160975,-0.897259,0.550226,-0.279661,0.181178,-0.948693,0.55762,0.45351,-0.749484,-0.541376,0.999188,0,0.32465,-0.948312,-0.279896,0.160975,-0.484628,-0.969268,-0.352099,0.181178,-0.948693,0.55762};
+const GLfloat rock1_lod2_normals[] = {0.202122,-0.971226,-0.125963,0.202122,-0.971226,-0.125963,0.202122,-0.971226,-0.125963,-0.1009,-0.366021,-0.92512,-0.1009,-0.366021,-0.92512,-0.1009,-0.366021,-0.92512,0.851739,-0.516187,-0.0899532,0.851739,-0.516187,-0.0899532,0.851739,-0.516187,-0.0899532,0.598279,-0.337387,0.726795,0.598279,-0.337387,0.726795,0.598279,-0.337387,0.726795,0.145042,-0.228305,-0.962725,0.145042,-0.228305,-0.962725,0.145042,-0.228305,-0.962725,-0.539346,-0.516363,0.665188,-0.539346,-0.516363,0.665188,-0.539346,-0.516363,0.665188,-0.580523,0.599836,-0.550627,-0.580523,0.599836,-0.550627,-0.580523,0.599836,-0.550627,0.725917,0.620216,0.297282,0.725917,0.620216,0.297282,0.725917,0.620216,0.297282,-0.570962,0.686698,0.449942,-0.570962,0.686698,0.449942,-0.570962,0.686698,0.449942,-0.283527,0.821319,0.495023,-0.283527,0.821319,0.495023,-0.283527,0.821319,0.495023,-0.0514358,0.95806,0.281915,-0.0514358,0.95806,0.281915,-0.0514358,0.95806,0.281915,-0.721627,0.358681,0.592116,-0.721627,0.358681,0.592116,-0.721627,0.358681,0.592116,0.595919,0.347577,0.723927,0.595919,0.347577,0.723927,0.595919,0.347577,0.723927,0.89427,0.437447,-0.094445,0.89427,0.437447,-0.094445,0.89427,0.437447,-0.094445,0.318436,0.425459,-0.847103,0.318436,0.425459,-0.847103,0.318436,0.425459,-0.847103,0.401678,0.510834,-0.760068,0.401678,0.510834,-0.760068,0.401678,0.510834,-0.760068,-0.74827,-0.172663,-0.640531,-0.74827,-0.172663,-0.640531,-0.74827,-0.172663,-0.640531,-0.847861,-0.206972,-0.488154,-0.847861,-0.206972,-0.488154,-0.847861,-0.206972,-0.488154,0.764129,-0.640899,0.0731791,0.764129,-0.640899,0.0731791,0.764129,-0.640899,0.0731791,-0.567003,-0.702047,0.430857,-0.567003,-0.702047,0.430857,-0.567003,-0.702047,0.430857};
+const GLfloat rock1_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock1_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock1_lod2_numind = 60;
+const GLsizeiptr rock1_lod2_numvert = 60;
+
+#endif
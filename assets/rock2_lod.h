@@ -0,0 +1,18 @@
+
+#ifndef rock2_lod_H
+#define rock2_lod_H
+
+const GLfloat rock2_lod1_vertices[] = {-0.677011,-0.231256,-0.688666,0.19107,-1.00049,-0.588065,-0.966626,-0.597413,0,0.19107,-1.00049,-0.588065,0.172022,-0.900749,0.529439,-0.966626,-0.597413,0,-0.677011,-0.231256,-0.688666,-0.966626,-0.597413,0,-0.940338,0.232831,-0.154229,0.962246,-0.236053,0.159254,0.773112,-0.590612,-0.561698,1.03955,0,-0.337763,0,0,1.04431,0.687792,-0.525433,0.499708,0.541661,0.530222,0.726056,-0.238804,-0.477609,-0.734949,0,0,-1.13363,0.639825,0,-0.880647,0.541661,0.530222,0.726056,1.03955,0,-0.337763,0.486545,0.973103,0.353492,-0.309182,0.500286,0.951584,0.541661,0.530222,0.726056,-0.183033,0.958403,0.563327,-0.940338,0.232831,-0.154229,-0.309182,0.500286,0.951584,-0.550011,0.889941,0,-0.550011,0.889941,0,-0.309182,0.500286,0.951584,-0.183033,0.958403,0.563327,-0.183033,0.958403,0.563327,0.486545,0.973103,0.353492,-0.550011,0.889941,0,-0.183033,0.958403,0.563327,0.541661,0.530222,0.726056,0.486545,0.973103,0.353492,0.486545,0.973103,0.353492,0.493445,0.986904,-0.358505,-0.550011,0.889941,0,0.486545,0.973103,0.353492,1.03955,0,-0.337763,0.493445,0.986904,-0.358505,0.493445,0.986904,-0.358505,-0.179439,0.939583,-0.552265,-0.550011,0.889941,0,-0.179439,0.939583,-0.552265,-0.940338,0.232831,-0.154229,-0.550011,0.889941,0,-0.99353,0,0.322812,-0.309182,0.500286,0.951584,-0.940338,0.232831,-0.154229,-0.99353,0,0.322812,-0.60402,0,0.831363,-0.309182,0.500286,0.951584,0,0,1.04431,0.541661,0.530222,0.726056,-0.309182,0.500286,0.951584,0.962246,-0.236053,0.159254,1.03955,0,-0.337763,0.541661,0.530222,0.726056,0.639825,0,-0.880647,0,0,-1.13363,0.493445,0.986904,-0.358505,0,0,-1.13363,-0.179439,0.939583,-0.552265,0.493445,0.986904,-0.358505,-0.677011,-0.231256,-0.688666,-0.940338,0.232831,-0.154229,-0.179439,0.939583,-0.552265,-0.60402,0,0.831363,0,0,1.04431,-0.309182,0.500286,0.951584,0.541661,0.530222,0.726056,0.687792,-0.525433,0.499708,0.962246,-0.236053,0.159254,1.03955,0,-0.337763,0.639825,0,-0.880647,0.493445,0.986904,-0.358505,1.03955,0,-0.337763,0.773112,-0.590612,-0.561698,0.639825,0,-0.880647,0.773112,-0.590612,-0.561698,-0.238804,-0.477609,-0.734949,0.639825,0,-0.880647,0,0,-1.13363,-0.677011,-0.231256,-0.688666,-0.179439,0.939583,-0.552265,0,0,-1.13363,-0.238804,-0.477609,-0.734949,-0.677011,-0.231256,-0.688666,-0.940338,0.232831,-0.154229,-0.966626,-0.597413,0,-0.99353,0,0.322812,-0.966626,-0.597413,0,-0.60402,0,0.831363,-0.99353,0,0.322812,-0.966626,-0.597413,0,0.172022,-0.900749,0.529439,-0.60402,0,0.831363,0.172022,-0.900749,0.529439,0,0,1.04431,-0.60402,0,0.831363,0.172022,-0.900749,0.529439,0.687792,-0.525433,0.499708,0,0,1.04431,0.172022,-0.900749,0.529439,0.962246,-0.236053,0.159254,0.687792,-0.525433,0.499708,0.172022,-0.900749,0.529439,0.773112,-0.590612,-0.561698,0.962246,-0.236053,0.159254,0.172022,-0.900749,0.529439,0.19107,-1.00049,-0.588065,0.773112,-0.590612,-0.561698,0.19107,-1.00049,-0.588065,-0.238804,-0.477609,-0.734949,0.773112,-0.590612,-0.561698,0.19107,-1.00049,-0.588065,-0.677011,-0.231256,-0.688666,-0.238804,-0.477609,-0.734949};
+const GLfloat rock2_lod1_normals[] = {-0.511587,-0.650709,-0.561121,-0.511587,-0.650709,-0.561121,-0.511587,-0.650709,-0.561121,-0.291213,-0.953297,0.0801221,-0.291213,-0.953297,0.0801221,-0.291213,-0.953297,0.0801221,-0.911611,-0.0469934,-0.408359,-0.911611,-0.0469934,-0.408359,-0.911611,-0.0469934,-0.408359,0.916963,-0.396354,-0.0456314,0.916963,-0.396354,-0.0456314,0.916963,-0.396354,-0.0456314,0.572089,-0.0954728,0.814616,0.572089,-0.0954728,0.814616,0.572089,-0.0954728,0.814616,0.265235,-0.692574,-0.670814,0.265235,-0.692574,-0.670814,0.265235,-0.692574,-0.670814,0.907176,0.331196,0.259501,0.907176,0.331196,0.259501,0.907176,0.331196,0.259501,0.183925,0.605547,0.774264,0.183925,0.605547,0.774264,0.183925,0.605547,0.774264,-0.832494,0.406032,0.376951,-0.832494,0.406032,0.376951,-0.832494,0.406032,0.376951,-0.729964,0.547619,0.40898,-0.729964,0.547619,0.40898,-0.729964,0.547619,0.40898,-0.0496032,0.994832,-0.0885896,-0.0496032,0.994832,-0.0885896,-0.0496032,0.994832,-0.0885896,0.215823,0.64416,0.733811,0.215823,0.64416,0.733811,0.215823,0.64416,0.733811,-0.0862163,0.996105,0.0184725,-0.0862163,0.996105,0.0184725,-0.0862163,0.996105,0.0184725,0.874677,0.484376,0.0178655,0.874677,0.484376,0.0178655,0.874677,0.484376,0.0178655,-0.0803182,0.996132,0.0356465,-0.0803182,0.996132,0.0356465,-0.0803182,0.996132,0.0356465,-0.72405,0.532878,-0.437941,-0.72405,0.532878,-0.437941,-0.72405,0.532878,-0.437941,-0.708443,0.662176,0.244196,-0.708443,0.662176,0.244196,-0.708443,0.662176,0.244196,-0.755737,0.306288,0.578835,-0.755737,0.306288,0.578835,-0.755737,0.306288,0.578835,0.232863,0.314482,0.920258,0.232863,0.314482,0.920258,0.232863,0.314482,0.920258,0.913657,0.293324,0.28141,0.913657,0.293324,0.28141,0.913657,0.293324,0.28141,0.322649,0.479589,-0.816022,0.322649,0.479589,-0.816022,0.322649,0.479589,-0.816022,0.19693,0.542788,-0.816455,0.19693,0.542788,-0.816455,0.19693,0.542788,-0.816455,-0.673102,0.361228,-0.645328,-0.673102,0.361228,-0.645328,-0.673102,0.361228,-0.645328,-0.332338,-0.030666,0.942662,-0.332338,-0.030666,0.942662,-0.332338,-0.030666,0.942662,0.787762,-0.0229358,0.615552,0.787762,-0.0229358,0.615552,0.787762,-0.0229358,0.615552,0.738932,0.397451,-0.54407,0.738932,0.397451,-0.54407,0.738932,0.397451,-0.54407,0.797658,-0.137153,-0.587309,0.797658,-0.137153,-0.587309,0.797658,-0.137153,-0.587309,0.100659,-0.455074,-0.884746,0.100659,-0.455074,-0.884746,0.100659,-0.455074,-0.884746,-0.594811,0.337759,-0.729465,-0.594811,0.337759,-0.729465,-0.594811,0.337759,-0.729465,-0.357698,-0.486516,-0.797091,-0.357698,-0.486516,-0.797091,-0.357698,-0.486516,-0.797091,-0.994396,0.0119743,-0.105036,-0.994396,0.0119743,-0.105036,-0.994396,0.0119743,-0.105036,-0.745931,-0.342308,0.571325,-0.745931,-0.342308,0.571325,-0.745931,-0.342308,0.571325,-0.46153,-0.612681,0.64157,-0.46153,-0.612681,0.64157,-0.46153,-0.612681,0.64157,-0.284787,-0.516121,0.807784,-0.284787,-0.516121,0.807784,-0.284787,-0.516121,0.807784,0.349534,-0.413749,0.840618,0.349534,-0.413749,0.840618,0.349534,-0.413749,0.840618,0.565728,-0.794831,-0.219534,0.565728,-0.794831,-0.219534,0.565728,-0.794831,-0.219534,0.680069,-0.712668,0.172076,0.680069,-0.712668,0.172076,0.680069,-0.712668,0.172076,0.571296,-0.816575,0.0826206,0.571296,-0.816575,0.0826206,0.571296,-0.816575,0.0826206,0.150444,-0.150783,-0.977052,0.150444,-0.150783,-0.977052,0.150444,-0.150783,-0.977052,-0.374986,-0.523251,-0.765241,-0.374986,-0.523251,-0.765241,-0.374986,-0.523251,-0.765241};
+const GLfloat rock2_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock2_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock2_lod1_numind = 120;
+const GLsizeiptr rock2_lod1_numvert = 120;
+const GLfloat rock2_lod2_vertices[] = {-0.677011,-0.231256,-0.688666,0.19107,-1.00049,-0.588065,-0.966626,-0.597413,0,0.19107,-1.00049,-0.588065,0.429907,-0.713091,0.514573,-0.966626,-0.597413,0,-0.677011,-0.231256,-0.688666,-0.966626,-0.597413,0,-0.99353,0,0.322812,0.270831,0.265111,0.885184,1.0009,-0.118027,-0.0892545,0.493445,0.986904,-0.358505,-0.456601,0.250143,0.891474,0.270831,0.265111,0.885184,-0.366522,0.924172,0.281664,-0.99353,0,0.322812,-0.456601,0.250143,0.891474,-0.366522,0.924172,0.281664,-0.366522,0.924172,0.281664,0.270831,0.265111,0.885184,0.493445,0.986904,-0.358505,0.493445,0.986904,-0.358505,-0.179439,0.939583,-0.552265,-0.366522,0.924172,0.281664,-0.179439,0.939583,-0.552265,-0.99353,0,0.322812,-0.366522,0.924172,0.281664,0.319912,0,-1.00714,-0.179439,0.939583,-0.552265,0.493445,0.986904,-0.358505,-0.677011,-0.231256,-0.688666,-0.99353,0,0.322812,-0.179439,0.939583,-0.552265,0.270831,0.265111,0.885184,0.429907,-0.713091,0.514573,1.0009,-0.118027,-0.0892545,1.0009,-0.118027,-0.0892545,0.319912,0,-1.00714,0.493445,0.986904,-0.358505,1.0009,-0.118027,-0.0892545,0.19107,-1.00049,-0.588065,0.319912,0,-1.00714,0.19107,-1.00049,-0.588065,-0.677011,-0.231256,-0.688666,0.319912,0,-1.00714,0.319912,0,-1.00714,-0.677011,-0.231256,-0.688666,-0.179439,0.939583,-0.552265,-0.966626,-0.597413,0,-0.456601,0.250143,0.891474,-0.99353,0,0.322812,-0.966626,-0.597413,0,0.429907,-0.713091,0.514573,-0.456601,0.250143,0.891474,0.429907,-0.713091,0.514573,0.270831,0.265111,0.885184,-0.456601,0.250143,0.891474,0.429907,-0.713091,0.514573,0.19107,-1.00049,-0.588065,1.0009,-0.118027,-0.0892545};
+const GLfloat rock2_lod2_normals[] = {-0.511587,-0.650709,-0.561121,-0.511587,-0.650709,-0.561121,-0.511587,-0.650709,-0.561121,-0.182908,-0.940952,0.284876,-0.182908,-0.940952,0.284876,-0.182908,-0.940952,0.284876,-0.93689,0.13261,-0.323498,-0.93689,0.13261,-0.323498,-0.93689,0.13261,-0.323498,0.787539,0.461271,0.408671,0.787539,0.461271,0.408671,0.787539,0.461271,0.408671,-0.00740792,0.671424,0.741037,-0.00740792,0.671424,0.741037,-0.00740792,0.671424,0.741037,-0.725381,0.512593,0.459424,-0.725381,0.512593,0.459424,-0.725381,0.512593,0.459424,0.327518,0.790563,0.517439,0.327518,0.790563,0.517439,0.327518,0.790563,0.517439,-0.0708779,0.997482,0.00253279,-0.0708779,0.997482,0.00253279,-0.0708779,0.997482,0.00253279,-0.818541,0.547617,-0.173511,-0.818541,0.547617,-0.173511,-0.818541,0.547617,-0.173511,0.204169,0.512342,-0.834158,0.204169,0.512342,-0.834158,0.204169,0.512342,-0.834158,-0.844482,0.400329,-0.35579,-0.844482,0.400329,-0.35579,-0.844482,0.400329,-0.35579,0.774128,-0.110278,0.62335,0.774128,-0.110278,0.62335,0.774128,-0.110278,0.62335,0.795662,0.228737,-0.560894,0.795662,0.228737,-0.560894,0.795662,0.228737,-0.560894,0.733542,-0.340775,-0.588038,0.733542,-0.340775,-0.588038,0.733542,-0.340775,-0.588038,-0.208814,-0.354829,-0.911314,-0.208814,-0.354829,-0.911314,-0.208814,-0.354829,-0.911314,-0.347132,0.252733,-0.90312,-0.347132,0.252733,-0.90312,-0.347132,0.252733,-0.90312,-0.565263,-0.411711,0.714823,-0.565263,-0.411711,0.714823,-0.565263,-0.411711,0.714823,-0.322248,-0.58714,0.742578,-0.322248,-0.58714,0.742578,-0.322248,-0.58714,0.742578,0.0153361,-0.35207,0.935848,0.0153361,-0.35207,0.935848,0.0153361,-0.35207,0.935848,0.731163,-0.681927,0.0193691,0.731163,-0.681927,0.0193691,0.731163,-0.681927,0.0193691};
+const GLfloat rock2_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock2_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock2_lod2_numind = 60;
+const GLsizeiptr rock2_lod2_numvert = 60;
+
+#endif
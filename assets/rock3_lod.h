@@ -0,0 +1,18 @@
+
+#ifndef rock3_lod_H
+#define rock3_lod_H
+
+const GLfloat rock3_lod1_vertices[] = {-0.730287,-0.451348,-0.530578,-0.210666,-0.930996,-0.153057,-0.703538,-0.574872,0.198677,-0.210666,-0.930996,-0.153057,0.298608,-0.483175,-0.919039,0.619313,-0.704855,-0.252831,-0.210666,-0.930996,-0.153057,0.619313,-0.704855,-0.252831,0.174741,-0.914987,0.537808,-0.210666,-0.930996,-0.153057,0.174741,-0.914987,0.537808,-0.703538,-0.574872,0.198677,-0.730287,-0.451348,-0.530578,-0.703538,-0.574872,0.198677,-0.98167,0,-0.318959,0.298608,-0.483175,-0.919039,-0.29255,0.473373,-0.900394,0.640341,0,-0.881356,-0.703538,-0.574872,0.198677,-0.600812,0,0.826946,-1.02624,0,0.333439,-0.29255,0.473373,-0.900394,-0.805758,0.495306,-0.254418,-0.169779,0.889001,-0.522534,0.640341,0,-0.881356,0.263105,0.52621,-0.809739,0.483976,0.967965,-0.351625,-0.805758,0.495306,-0.254418,-0.710593,0.542851,0.516274,0,0.990811,0,-0.710593,0.542851,0.516274,-0.00839201,0.488885,0.834453,0,0.990811,0,0,0.990811,0,-0.00839201,0.488885,0.834453,0.483976,0.967965,-0.351625,-0.00839201,0.488885,0.834453,0.744357,0.460043,0.540801,0.483976,0.967965,-0.351625,0.744357,0.460043,0.540801,0.640341,0,-0.881356,0.483976,0.967965,-0.351625,0.483976,0.967965,-0.351625,-0.169779,0.889001,-0.522534,0,0.990811,0,0.483976,0.967965,-0.351625,0.263105,0.52621,-0.809739,-0.169779,0.889001,-0.522534,0.263105,0.52621,-0.809739,-0.29255,0.473373,-0.900394,-0.169779,0.889001,-0.522534,-0.169779,0.889001,-0.522534,-0.805758,0.495306,-0.254418,0,0.990811,0,-1.02624,0,0.333439,-0.710593,0.542851,0.516274,-0.805758,0.495306,-0.254418,-1.02624,0,0.333439,-0.600812,0,0.826946,-0.710593,0.542851,0.516274,-0.600812,0,0.826946,-0.00839201,0.488885,0.834453,-0.710593,0.542851,0.516274,0.277291,-0.448682,0.85343,0.604599,0,0.832159,-0.00839201,0.488885,0.834453,0.604599,0,0.832159,0.744357,0.460043,0.540801,-0.00839201,0.488885,0.834453,1.10136,0,-0.357848,0.640341,0,-0.881356,0.744357,0.460043,0.540801,0.640341,0,-0.881356,-0.29255,0.473373,-0.900394,0.263105,0.52621,-0.809739,-0.730287,-0.451348,-0.530578,-0.805758,0.495306,-0.254418,-0.29255,0.473373,-0.900394,-0.730287,-0.451348,-0.530578,-0.98167,0,-0.318959,-0.805758,0.495306,-0.254418,-0.600812,0,0.826946,0.277291,-0.448682,0.85343,-0.00839201,0.488885,0.834453,0.604599,0,0.832159,1.10136,0,-0.357848,0.744357,0.460043,0.540801,0.604599,0,0.832159,0.619313,-0.704855,-0.252831,1.10136,0,-0.357848,1.10136,0,-0.357848,0.619313,-0.704855,-0.252831,0.640341,0,-0.881356,0.619313,-0.704855,-0.252831,0.298608,-0.483175,-0.919039,0.640341,0,-0.881356,-0.29255,0.473373,-0.900394,0.298608,-0.483175,-0.919039,-0.730287,-0.451348,-0.530578,-0.98167,0,-0.318959,-1.02624,0,0.333439,-0.805758,0.495306,-0.254418,-0.98167,0,-0.318959,-0.703538,-0.574872,0.198677,-1.02624,0,0.333439,-0.703538,-0.574872,0.198677,0.174741,-0.914987,0.537808,-0.600812,0,0.826946,0.174741,-0.914987,0.537808,0.277291,-0.448682,0.85343,-0.600812,0,0.826946,0.174741,-0.914987,0.537808,0.604599,0,0.832159,0.277291,-0.448682,0.85343,0.174741,-0.914987,0.537808,0.619313,-0.704855,-0.252831,0.604599,0,0.832159,-0.210666,-0.930996,-0.153057,-0.730287,-0.451348,-0.530578,0.298608,-0.483175,-0.919039};
+const GLfloat rock3_lod1_normals[] = {-0.631321,-0.768111,-0.106949,-0.631321,-0.768111,-0.106949,-0.631321,-0.768111,-0.106949,0.197292,-0.897809,-0.393719,0.197292,-0.897809,-0.393719,0.197292,-0.897809,-0.393719,0.248087,-0.961754,-0.116112,0.248087,-0.961754,-0.116112,0.248087,-0.961754,-0.116112,-0.434943,-0.861317,0.262597,-0.434943,-0.861317,0.262597,-0.434943,-0.861317,0.262597,-0.881892,-0.469092,-0.0471088,-0.881892,-0.469092,-0.0471088,-0.881892,-0.469092,-0.0471088,0.0440495,0.0466749,-0.997938,0.0440495,0.0466749,-0.997938,0.0440495,0.0466749,-0.997938,-0.655692,-0.500572,0.565239,-0.655692,-0.500572,0.565239,-0.655692,-0.500572,0.565239,-0.598495,0.628466,-0.496824,-0.598495,0.628466,-0.496824,-0.598495,0.628466,-0.496824,0.524456,0.472388,-0.708376,0.524456,0.472388,-0.708376,0.524456,0.472388,-0.708376,-0.526674,0.849974,0.0125977,-0.526674,0.849974,0.0125977,-0.526674,0.849974,0.0125977,-0.164798,0.845939,0.507178,-0.164798,0.845939,0.507178,-0.164798,0.845939,0.507178,0.384945,0.789174,0.478562,0.384945,0.789174,0.478562,0.384945,0.789174,0.478562,0.204563,0.87518,0.438422,0.204563,0.87518,0.438422,0.204563,0.87518,0.438422,0.960826,0.235331,-0.1464,0.960826,0.235331,-0.1464,0.960826,0.235331,-0.1464,-0.0750407,0.98307,-0.167159,-0.0750407,0.98307,-0.167159,-0.0750407,0.98307,-0.167159,0.103742,0.690497,-0.715857,0.103742,0.690497,-0.715857,0.103742,0.690497,-0.715857,0.058971,0.661925,-0.747247,0.058971,0.661925,-0.747247,0.058971,0.661925,-0.747247,-0.524906,0.851147,0.00471286,-0.524906,0.851147,0.00471286,-0.524906,0.851147,0.00471286,-0.873049,0.481335,0.07811,-0.873049,0.481335,0.07811,-0.873049,0.481335,0.07811,-0.73965,0.215325,0.637615,-0.73965,0.215325,0.637615,-0.73965,0.215325,0.637615,-0.349855,0.411021,0.841821,-0.349855,0.411021,0.841821,-0.349855,0.411021,0.841821,0.0262493,0.028224,0.999257,0.0262493,0.028224,0.999257,0.0262493,0.028224,0.999257,0.342919,0.426042,0.837195,0.342919,0.426042,0.837195,0.342919,0.426042,0.837195,0.353401,0.882185,-0.311219,0.353401,0.882185,-0.311219,0.353401,0.882185,-0.311219,0.135571,0.228401,-0.964082,0.135571,0.228401,-0.964082,0.135571,0.228401,-0.964082,-0.775433,0.119077,-0.6201,-0.775433,0.119077,-0.6201,-0.775433,0.119077,-0.6201,-0.337921,0.238648,-0.910415,-0.337921,0.238648,-0.910415,-0.337921,0.238648,-0.910415,-0.0234642,0.0130837,0.999639,-0.0234642,0.0130837,0.999639,-0.0234642,0.0130837,0.999639,0.922212,-0.0363472,0.384974,0.922212,-0.0363472,0.384974,0.922212,-0.0363472,0.384974,0.800442,-0.497637,0.334141,0.800442,-0.497637,0.334141,0.800442,-0.497637,0.334141,0.640194,-0.521827,-0.56378,0.640194,-0.521827,-0.56378,0.640194,-0.521827,-0.56378,0.722787,-0.471822,-0.50494,0.722787,-0.471822,-0.50494,0.722787,-0.471822,-0.50494,-0.351514,-0.199411,-0.914698,-0.351514,-0.199411,-0.914698,-0.351514,-0.199411,-0.914698,-0.937735,0.341392,-0.064062,-0.937735,0.341392,-0.064062,-0.937735,0.341392,-0.064062,-0.876367,-0.477909,-0.0598696,-0.876367,-0.477909,-0.0598696,-0.876367,-0.477909,-0.0598696,-0.479707,-0.606862,0.63372,-0.479707,-0.606862,0.63372,-0.479707,-0.606862,0.63372,-0.278112,-0.495721,0.822748,-0.278112,-0.495721,0.822748,-0.278112,-0.495721,0.822748,0.71074,-0.49477,0.500051,0.71074,-0.49477,0.500051,0.71074,-0.49477,0.500051,0.81065,-0.485932,0.326676,0.81065,-0.485932,0.326676,0.81065,-0.485932,0.326676,-0.252858,-0.752534,-0.608075,-0.252858,-0.752534,-0.608075,-0.252858,-0.752534,-0.608075};
+const GLfloat rock3_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock3_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock3_lod1_numind = 120;
+const GLsizeiptr rock3_lod1_numvert = 120;
+const GLfloat rock3_lod2_vertices[] = {-0.830868,0.134816,-0.339593,-0.0179627,-0.922992,0.192376,-0.703538,-0.574872,0.198677,-0.0179627,-0.922992,0.192376,0.298608,-0.483175,-0.919039,0.619313,-0.704855,-0.252831,0.298608,-0.483175,-0.919039,-0.29255,0.473373,-0.900394,0.451723,0.263105,-0.845547,-0.830868,0.134816,-0.339593,-0.734614,0.135713,0.625901,0.241988,0.979388,-0.175812,-0.734614,0.135713,0.625901,-0.00839201,0.488885,0.834453,0.241988,0.979388,-0.175812,-0.00839201,0.488885,0.834453,0.92286,0.230022,0.0914765,0.241988,0.979388,-0.175812,0.92286,0.230022,0.0914765,0.451723,0.263105,-0.845547,0.241988,0.979388,-0.175812,0.241988,0.979388,-0.175812,0.451723,0.263105,-0.845547,-0.29255,0.473373,-0.900394,-0.29255,0.473373,-0.900394,-0.830868,0.134816,-0.339593,0.241988,0.979388,-0.175812,0.440945,-0.224341,0.842794,0.92286,0.230022,0.0914765,-0.00839201,0.488885,0.834453,-0.734614,0.135713,0.625901,0.440945,-0.224341,0.842794,-0.00839201,0.488885,0.834453,0.440945,-0.224341,0.842794,0.619313,-0.704855,-0.252831,0.92286,0.230022,0.0914765,0.92286,0.230022,0.0914765,0.619313,-0.704855,-0.252831,0.451723,0.263105,-0.845547,0.619313,-0.704855,-0.252831,0.298608,-0.483175,-0.919039,0.451723,0.263105,-0.845547,-0.29255,0.473373,-0.900394,0.298608,-0.483175,-0.919039,-0.830868,0.134816,-0.339593,-0.830868,0.134816,-0.339593,-0.703538,-0.574872,0.198677,-0.734614,0.135713,0.625901,-0.703538,-0.574872,0.198677,-0.0179627,-0.922992,0.192376,-0.734614,0.135713,0.625901,-0.0179627,-0.922992,0.192376,0.440945,-0.224341,0.842794,-0.734614,0.135713,0.625901,-0.0179627,-0.922992,0.192376,0.619313,-0.704855,-0.252831,0.440945,-0.224341,0.842794,-0.0179627,-0.922992,0.192376,-0.830868,0.134816,-0.339593,0.298608,-0.483175,-0.919039};
+const GLfloat rock3_lod2_normals[] = {-0.315775,-0.608702,-0.727852,-0.315775,-0.608702,-0.727852,-0.315775,-0.608702,-0.727852,0.0767996,-0.934386,-0.347886,0.0767996,-0.934386,-0.347886,0.0767996,-0.934386,-0.347886,0.0952199,0.0781905,-0.992381,0.0952199,0.0781905,-0.992381,0.0952199,0.0781905,-0.992381,-0.623155,0.779684,0.0614008,-0.623155,0.779684,0.0614008,-0.623155,0.779684,0.0614008,-0.483898,0.828357,0.282256,-0.483898,0.828357,0.282256,-0.483898,0.828357,0.282256,0.563583,0.679578,0.469625,0.563583,0.679578,0.469625,0.563583,0.679578,0.469625,0.751067,0.554704,-0.358053,0.751067,0.554704,-0.358053,0.751067,0.554704,-0.358053,0.247018,0.699416,-0.670671,0.247018,0.699416,-0.670671,0.247018,0.699416,-0.670671,-0.605253,0.789132,-0.104587,-0.605253,0.789132,-0.104587,-0.605253,0.789132,-0.104587,0.63596,0.408318,0.654853,0.63596,0.408318,0.654853,0.63596,0.408318,0.654853,-0.217021,-0.125403,0.968078,-0.217021,-0.125403,0.968078,-0.217021,-0.125403,0.968078,0.862921,-0.395864,0.3141,0.862921,-0.395864,0.3141,0.862921,-0.395864,0.3141,0.885028,-0.121889,-0.449297,0.885028,-0.121889,-0.449297,0.885028,-0.121889,-0.449297,0.874842,-0.13364,-0.465608,0.874842,-0.13364,-0.465608,0.874842,-0.13364,-0.465608,-0.569187,-0.337147,-0.749905,-0.569187,-0.337147,-0.749905,-0.569187,-0.337147,-0.749905,-0.989799,-0.102672,0.0987727,-0.989799,-0.102672,0.0987727,-0.989799,-0.102672,0.0987727,-0.249826,-0.506932,0.824989,-0.249826,-0.506932,0.824989,-0.249826,-0.506932,0.824989,-0.308392,-0.531742,0.788761,-0.308392,-0.531742,0.788761,-0.308392,-0.531742,0.788761,0.538595,-0.735853,0.41041,0.538595,-0.735853,0.41041,0.538595,-0.735853,0.41041,-0.593785,-0.675874,-0.436593,-0.593785,-0.675874,-0.436593,-0.593785,-0.675874,-0.436593};
+const GLfloat rock3_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock3_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock3_lod2_numind = 60;
+const GLsizeiptr rock3_lod2_numvert = 60;
+
+#endif
@@ -0,0 +1,18 @@
+
+#ifndef rock4_lod_H
+#define rock4_lod_H
+
+const GLfloat rock4_lod1_vertices[] = {-0.202948,-0.896487,0.147448,-0.43503,-0.870069,-0.316064,0.170229,-0.891358,-0.52392,-0.277109,-0.554218,-0.852839,-0.43503,-0.870069,-0.316064,-0.927124,-0.572999,0,-0.202948,-0.896487,0.147448,0.170229,-0.891358,-0.52392,0.569275,-0.921111,0,-0.202948,-0.896487,0.147448,0.569275,-0.921111,0,0.16194,-0.847952,0.498407,-0.277109,-0.554218,-0.852839,-0.927124,-0.572999,0,-1.00528,0,-0.326629,0.569275,-0.921111,0,0.693546,0,-0.954591,1.08062,0,0.351107,0,0,1.18044,0.704913,-0.538512,0.512147,1.08062,0,0.351107,-0.794281,-0.490896,0.577071,0.16194,-0.847952,0.498407,-0.307311,0.497258,0.945825,-0.277109,-0.554218,-0.852839,-1.00528,0,-0.326629,-0.276532,0,-0.853438,-0.277109,-0.554218,-0.852839,-0.276532,0,-0.853438,0.693546,0,-0.954591,-0.307311,0.497258,0.945825,0.291533,0.583065,0.89723,-0.0952285,1.07796,0.293089,-0.796216,0.487357,0.245669,-0.307311,0.497258,0.945825,-0.0952285,1.07796,0.293089,-0.0952285,1.07796,0.293089,0.291533,0.583065,0.89723,0.644795,0.696818,0.156826,0.644795,0.696818,0.156826,0.630338,0.710902,-0.457962,-0.0952285,1.07796,0.293089,0.630338,0.710902,-0.457962,-0.458846,0.461182,-0.637955,-0.0952285,1.07796,0.293089,0.630338,0.710902,-0.457962,0.26945,0.5389,-0.829266,-0.458846,0.461182,-0.637955,-0.458846,0.461182,-0.637955,-0.796216,0.487357,0.245669,-0.0952285,1.07796,0.293089,-0.794281,-0.490896,0.577071,-0.307311,0.497258,0.945825,-0.796216,0.487357,0.245669,0,0,1.18044,0.291533,0.583065,0.89723,-0.307311,0.497258,0.945825,0,0,1.18044,1.08062,0,0.351107,0.291533,0.583065,0.89723,1.08062,0,0.351107,0.644795,0.696818,0.156826,0.291533,0.583065,0.89723,1.08062,0,0.351107,0.630338,0.710902,-0.457962,0.644795,0.696818,0.156826,0.693546,0,-0.954591,0.26945,0.5389,-0.829266,0.630338,0.710902,-0.457962,0.693546,0,-0.954591,-0.276532,0,-0.853438,0.26945,0.5389,-0.829266,-0.276532,0,-0.853438,-0.458846,0.461182,-0.637955,0.26945,0.5389,-0.829266,-0.276532,0,-0.853438,-1.00528,0,-0.326629,-0.458846,0.461182,-0.637955,-1.00528,0,-0.326629,-0.796216,0.487357,0.245669,-0.458846,0.461182,-0.637955,-0.307311,0.497258,0.945825,0.16194,-0.847952,0.498407,0,0,1.18044,0.704913,-0.538512,0.512147,0.569275,-0.921111,0,1.08062,0,0.351107,1.08062,0,0.351107,0.693546,0,-0.954591,0.630338,0.710902,-0.457962,-1.00528,0,-0.326629,-0.794281,-0.490896,0.577071,-0.796216,0.487357,0.245669,-1.00528,0,-0.326629,-0.927124,-0.572999,0,-0.794281,-0.490896,0.577071,-0.202948,-0.896487,0.147448,0.16194,-0.847952,0.498407,-0.794281,-0.490896,0.577071,0.16194,-0.847952,0.498407,0.704913,-0.538512,0.512147,0,0,1.18044,0.16194,-0.847952,0.498407,0.569275,-0.921111,0,0.704913,-0.538512,0.512147,0.569275,-0.921111,0,0.170229,-0.891358,-0.52392,0.693546,0,-0.954591,0.170229,-0.891358,-0.52392,-0.277109,-0.554218,-0.852839,0.693546,0,-0.954591,-0.927124,-0.572999,0,-0.202948,-0.896487,0.147448,-0.794281,-0.490896,0.577071,-0.927124,-0.572999,0,-0.43503,-0.870069,-0.316064,-0.202948,-0.896487,0.147448,0.170229,-0.891358,-0.52392,-0.43503,-0.870069,-0.316064,-0.277109,-0.554218,-0.852839};
+const GLfloat rock4_lod1_normals[] = {-0.0466371,-0.998348,-0.0335507,-0.0466371,-0.998348,-0.0335507,-0.0466371,-0.998348,-0.0335507,-0.660584,-0.54579,-0.515502,-0.660584,-0.54579,-0.515502,-0.660584,-0.54579,-0.515502,-0.0372637,-0.998903,-0.0283448,-0.0372637,-0.998903,-0.0283448,-0.0372637,-0.998903,-0.0283448,-0.00452671,-0.989913,0.141605,-0.00452671,-0.989913,0.141605,-0.00452671,-0.989913,0.141605,-0.71894,-0.415633,-0.557113,-0.71894,-0.415633,-0.557113,-0.71894,-0.415633,-0.557113,0.882724,-0.390284,-0.261681,0.882724,-0.390284,-0.261681,0.882724,-0.390284,-0.261681,0.598398,-0.184314,0.779711,0.598398,-0.184314,0.779711,0.598398,-0.184314,0.779711,-0.0454628,-0.329519,0.943054,-0.0454628,-0.329519,0.943054,-0.0454628,-0.329519,0.943054,-0.58585,-0.000266006,-0.810419,-0.58585,-0.000266006,-0.810419,-0.58585,-0.000266006,-0.810419,-0.103711,-0.000967047,-0.994607,-0.103711,-0.000967047,-0.994607,-0.103711,-0.000967047,-0.994607,-0.0551177,0.754822,0.653609,-0.0551177,0.754822,0.653609,-0.0551177,0.754822,0.653609,-0.603329,0.683046,0.411634,-0.603329,0.683046,0.411634,-0.603329,0.683046,0.411634,0.478982,0.804126,0.352075,0.478982,0.804126,0.352075,0.478982,0.804126,0.352075,0.459244,0.888259,0.00955061,0.459244,0.888259,0.00955061,0.459244,0.888259,0.00955061,-0.108564,0.847737,-0.519187,-0.108564,0.847737,-0.519187,-0.108564,0.847737,-0.519187,-0.172296,0.946973,-0.271211,-0.172296,0.946973,-0.271211,-0.172296,0.946973,-0.271211,-0.612653,0.747723,-0.256062,-0.612653,0.747723,-0.256062,-0.612653,0.747723,-0.256062,-0.806478,0.18828,0.560485,-0.806478,0.18828,0.560485,-0.806478,0.18828,0.560485,0.0112175,0.432339,0.901641,0.0112175,0.432339,0.901641,0.0112175,0.432339,0.901641,0.606845,0.0806465,0.790718,0.606845,0.0806465,0.790718,0.606845,0.0806465,0.790718,0.709495,0.562215,0.424891,0.709495,0.562215,0.424891,0.709495,0.562215,0.424891,0.848784,0.528681,-0.00784707,0.848784,0.528681,-0.00784707,0.848784,0.528681,-0.00784707,0.469711,0.533265,-0.703563,0.469711,0.533265,-0.703563,0.469711,0.533265,-0.703563,-0.102568,0.148037,-0.983649,-0.102568,0.148037,-0.983649,-0.102568,0.148037,-0.983649,-0.272458,0.316789,-0.908521,-0.272458,0.316789,-0.908521,-0.272458,0.316789,-0.908521,-0.579616,0.145497,-0.801795,-0.579616,0.145497,-0.801795,-0.579616,0.145497,-0.801795,-0.708308,0.643806,-0.289505,-0.708308,0.643806,-0.289505,-0.708308,0.643806,-0.289505,-0.869173,-0.399931,0.29085,-0.869173,-0.399931,0.29085,-0.869173,-0.399931,0.29085,0.831275,-0.527865,0.174185,0.831275,-0.527865,0.174185,0.831275,-0.527865,0.174185,0.922335,0.273018,-0.273423,0.922335,0.273018,-0.273423,0.922335,0.273018,-0.273423,-0.957802,0.090522,0.272801,-0.957802,0.090522,0.272801,-0.957802,0.090522,0.272801,-0.974356,-0.00466085,0.224962,-0.974356,-0.00466085,0.224962,-0.974356,-0.00466085,0.224962,-0.287408,-0.861787,0.417995,-0.287408,-0.861787,0.417995,-0.287408,-0.861787,0.417995,0.30088,-0.562158,0.770357,0.30088,-0.562158,0.770357,0.30088,-0.562158,0.770357,0.429523,-0.774317,0.464697,0.429523,-0.774317,0.464697,0.429523,-0.774317,0.464697,0.616321,-0.605258,-0.503796,0.616321,-0.605258,-0.503796,0.616321,-0.605258,-0.503796,0.212326,-0.523375,-0.825225,0.212326,-0.523375,-0.825225,0.212326,-0.523375,-0.825225,-0.435168,-0.871978,0.224238,-0.435168,-0.871978,0.224238,-0.435168,-0.871978,0.224238,-0.430052,-0.887647,0.164736,-0.430052,-0.887647,0.164736,-0.430052,-0.887647,0.164736,-0.214535,-0.812902,-0.541447,-0.214535,-0.812902,-0.541447,-0.214535,-0.812902,-0.541447};
+const GLfloat rock4_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock4_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock4_lod1_numind = 120;
+const GLsizeiptr rock4_lod1_numvert = 120;
+const GLfloat rock4_lod2_vertices[] = {-0.020504,-0.87222,0.322928,-0.277109,-0.554218,-0.852839,0.637094,-0.729811,0.256074,0.637094,-0.729811,0.256074,0.693546,0,-0.954591,1.08062,0,0.351107,0,0,1.18044,0.637094,-0.729811,0.256074,1.08062,0,0.351107,-0.880241,-0.388698,0.206878,-0.020504,-0.87222,0.322928,0,0,1.18044,0,0,1.18044,0.468164,0.639941,0.527028,-0.0952285,1.07796,0.293089,-0.796216,0.487357,0.245669,0,0,1.18044,-0.0952285,1.07796,0.293089,0.468164,0.639941,0.527028,0.630338,0.710902,-0.457962,-0.0952285,1.07796,0.293089,0.630338,0.710902,-0.457962,-0.458846,0.461182,-0.637955,-0.0952285,1.07796,0.293089,-0.458846,0.461182,-0.637955,-0.796216,0.487357,0.245669,-0.0952285,1.07796,0.293089,-0.880241,-0.388698,0.206878,0,0,1.18044,-0.796216,0.487357,0.245669,0,0,1.18044,1.08062,0,0.351107,0.468164,0.639941,0.527028,1.08062,0,0.351107,0.630338,0.710902,-0.457962,0.468164,0.639941,0.527028,0.693546,0,-0.954591,-0.277109,-0.554218,-0.852839,0.630338,0.710902,-0.457962,-0.277109,-0.554218,-0.852839,-0.458846,0.461182,-0.637955,0.630338,0.710902,-0.457962,-0.277109,-0.554218,-0.852839,-0.880241,-0.388698,0.206878,-0.458846,0.461182,-0.637955,-0.880241,-0.388698,0.206878,-0.796216,0.487357,0.245669,-0.458846,0.461182,-0.637955,1.08062,0,0.351107,0.693546,0,-0.954591,0.630338,0.710902,-0.457962,-0.020504,-0.87222,0.322928,0.637094,-0.729811,0.256074,0,0,1.18044,0.637094,-0.729811,0.256074,-0.277109,-0.554218,-0.852839,0.693546,0,-0.954591,-0.880241,-0.388698,0.206878,-0.277109,-0.554218,-0.852839,-0.020504,-0.87222,0.322928};
+const GLfloat rock4_lod2_normals[] = {0.17393,-0.940378,-0.292297,0.17393,-0.940378,-0.292297,0.17393,-0.940378,-0.292297,0.841622,-0.478983,-0.249496,0.841622,-0.478983,-0.249496,0.841622,-0.478983,-0.249496,0.550303,-0.427802,0.717044,0.550303,-0.427802,0.717044,0.550303,-0.427802,0.717044,-0.438578,-0.624781,0.645986,-0.438578,-0.624781,0.645986,-0.438578,-0.624781,0.645986,0.181321,0.634509,0.751346,0.181321,0.634509,0.751346,0.181321,0.634509,0.751346,-0.491182,0.527322,0.693305,-0.491182,0.527322,0.693305,-0.491182,0.527322,0.693305,0.566672,0.809868,0.151645,0.566672,0.809868,0.151645,0.566672,0.809868,0.151645,-0.108564,0.847737,-0.519187,-0.108564,0.847737,-0.519187,-0.108564,0.847737,-0.519187,-0.612653,0.747723,-0.256062,-0.612653,0.747723,-0.256062,-0.612653,0.747723,-0.256062,-0.749497,0.0426344,0.660633,-0.749497,0.0426344,0.660633,-0.749497,0.0426344,0.660633,0.571997,0.342539,0.74531,0.571997,0.342539,0.74531,0.571997,0.342539,0.74531,0.734849,0.657012,0.168322,0.734849,0.657012,0.168322,0.734849,0.657012,0.168322,-0.372052,0.509116,-0.77613,-0.372052,0.509116,-0.77613,-0.372052,0.509116,-0.77613,0.108594,0.22438,-0.968432,0.108594,0.22438,-0.968432,0.108594,0.22438,-0.968432,-0.871407,-0.0527522,-0.487717,-0.871407,-0.0527522,-0.487717,-0.871407,-0.0527522,-0.487717,-0.928036,0.104837,-0.357432,-0.928036,0.104837,-0.357432,-0.928036,0.104837,-0.357432,0.922335,0.273018,-0.273423,0.922335,0.273018,-0.273423,0.922335,0.273018,-0.273423,0.219168,-0.686638,0.693176,0.219168,-0.686638,0.693176,0.219168,-0.686638,0.693176,0.403957,-0.791646,-0.458383,0.403957,-0.791646,-0.458383,0.403957,-0.791646,-0.458383,-0.472206,-0.871452,-0.132639,-0.472206,-0.871452,-0.132639,-0.472206,-0.871452,-0.132639};
+const GLfloat rock4_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock4_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock4_lod2_numind = 60;
+const GLsizeiptr rock4_lod2_numvert = 60;
+
+#endif
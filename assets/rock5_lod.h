@@ -0,0 +1,18 @@
+
+#ifndef rock5_lod_H
+#define rock5_lod_H
+
+const GLfloat rock5_lod1_vertices[] = {0.302959,-0.490216,-0.932431,-0.298824,-0.597648,-0.919669,-0.130483,0.211132,-0.887217,0.256722,-0.415397,0.79012,0.703043,-0.537083,0.510789,0.782107,0.483373,0.568227,0.302959,-0.490216,-0.932431,-0.130483,0.211132,-0.887217,0.688944,-0.526313,-0.500546,0.256722,-0.415397,0.79012,0.782107,0.483373,0.568227,-0.237819,0.384809,0.731939,-0.648136,-0.400577,0.470893,-0.508071,0,0.699293,-0.91181,0,0.296261,-0.130483,0.211132,-0.887217,-0.617687,0.471877,-0.448773,-0.158474,0.829807,-0.487742,0.590348,0.364865,-0.197149,0.276996,0.553992,-0.85249,0.318996,0.637994,0.231761,0.782107,0.483373,0.568227,0.590348,0.364865,-0.197149,0.318996,0.637994,0.231761,-0.59747,0.456432,0.434084,-0.127857,0.669485,0.393509,-0.158474,0.829807,-0.487742,-0.59747,0.456432,0.434084,-0.237819,0.384809,0.731939,-0.127857,0.669485,0.393509,-0.127857,0.669485,0.393509,0.318996,0.637994,0.231761,-0.158474,0.829807,-0.487742,-0.127857,0.669485,0.393509,-0.237819,0.384809,0.731939,0.318996,0.637994,0.231761,-0.237819,0.384809,0.731939,0.782107,0.483373,0.568227,0.318996,0.637994,0.231761,0.318996,0.637994,0.231761,0.276996,0.553992,-0.85249,-0.158474,0.829807,-0.487742,0.276996,0.553992,-0.85249,-0.130483,0.211132,-0.887217,-0.158474,0.829807,-0.487742,-0.158474,0.829807,-0.487742,-0.617687,0.471877,-0.448773,-0.59747,0.456432,0.434084,-0.91181,0,0.296261,-0.59747,0.456432,0.434084,-0.617687,0.471877,-0.448773,-0.91181,0,0.296261,-0.508071,0,0.699293,-0.59747,0.456432,0.434084,-0.508071,0,0.699293,-0.237819,0.384809,0.731939,-0.59747,0.456432,0.434084,0.727953,-0.363982,0,0.590348,0.364865,-0.197149,0.782107,0.483373,0.568227,0.727953,-0.363982,0,0.688944,-0.526313,-0.500546,0.590348,0.364865,-0.197149,0.688944,-0.526313,-0.500546,0.276996,0.553992,-0.85249,0.590348,0.364865,-0.197149,0.688944,-0.526313,-0.500546,-0.130483,0.211132,-0.887217,0.276996,0.553992,-0.85249,-0.130483,0.211132,-0.887217,-0.91181,0,0.296261,-0.617687,0.471877,-0.448773,-0.508071,0,0.699293,-0.648136,-0.400577,0.470893,-0.237819,0.384809,0.731939,-0.648136,-0.400577,0.470893,0.256722,-0.415397,0.79012,-0.237819,0.384809,0.731939,0.782107,0.483373,0.568227,0.703043,-0.537083,0.510789,0.727953,-0.363982,0,-0.298824,-0.597648,-0.919669,-0.91181,0,0.296261,-0.130483,0.211132,-0.887217,-0.399811,-0.799629,-0.290476,-0.648136,-0.400577,0.470893,-0.91181,0,0.296261,-0.378497,-0.757,0.274991,0.256722,-0.415397,0.79012,-0.648136,-0.400577,0.470893,-0.378497,-0.757,0.274991,0.703043,-0.537083,0.510789,0.256722,-0.415397,0.79012,-0.378497,-0.757,0.274991,0.158696,-0.830971,-0.488426,0.703043,-0.537083,0.510789,0.158696,-0.830971,-0.488426,0.727953,-0.363982,0,0.703043,-0.537083,0.510789,0.158696,-0.830971,-0.488426,0.688944,-0.526313,-0.500546,0.727953,-0.363982,0,0.158696,-0.830971,-0.488426,0.302959,-0.490216,-0.932431,0.688944,-0.526313,-0.500546,-0.399811,-0.799629,-0.290476,-0.378497,-0.757,0.274991,-0.648136,-0.400577,0.470893,-0.399811,-0.799629,-0.290476,0.158696,-0.830971,-0.488426,-0.378497,-0.757,0.274991,0.158696,-0.830971,-0.488426,-0.298824,-0.597648,-0.919669,0.302959,-0.490216,-0.932431,0.158696,-0.830971,-0.488426,-0.399811,-0.799629,-0.290476,-0.298824,-0.597648,-0.919669,-0.399811,-0.799629,-0.290476,-0.91181,0,0.296261,-0.298824,-0.597648,-0.919669};
+const GLfloat rock5_lod1_normals[] = {-0.0294208,0.0461881,-0.998499,-0.0294208,0.0461881,-0.998499,-0.0294208,0.0461881,-0.998499,0.511176,-0.0877298,0.854987,0.511176,-0.0877298,0.854987,0.511176,-0.0877298,0.854987,0.681504,0.457976,-0.570797,0.681504,0.457976,-0.570797,0.681504,0.457976,-0.570797,0.141529,0.158514,0.977161,0.141529,0.158514,0.977161,0.141529,0.158514,0.977161,-0.697991,-0.154619,0.699215,-0.697991,-0.154619,0.699215,-0.697991,-0.154619,0.699215,-0.434807,0.474517,-0.76536,-0.434807,0.474517,-0.76536,-0.434807,0.474517,-0.76536,0.637806,0.765601,-0.084021,0.637806,0.765601,-0.084021,0.637806,0.765601,-0.084021,0.464062,0.850396,-0.247939,0.464062,0.850396,-0.247939,0.464062,0.850396,-0.247939,-0.393791,0.90185,0.177751,-0.393791,0.90185,0.177751,-0.393791,0.90185,0.177751,-0.303964,0.77541,0.553485,-0.303964,0.77541,0.553485,-0.303964,0.77541,0.553485,0.131416,0.976113,0.173014,0.131416,0.976113,0.173014,0.131416,0.976113,0.173014,0.290511,0.683672,0.669474,0.290511,0.683672,0.669474,0.290511,0.683672,0.669474,-0.0168533,0.899515,0.436564,-0.0168533,0.899515,0.436564,-0.0168533,0.899515,0.436564,0.480536,0.872725,-0.0862284,0.480536,0.872725,-0.0862284,0.480536,0.872725,-0.0862284,-0.350367,0.49682,-0.793985,-0.350367,0.49682,-0.793985,-0.350367,0.49682,-0.793985,-0.613048,0.789554,0.0278512,-0.613048,0.789554,0.0278512,-0.613048,0.789554,0.0278512,-0.827279,0.561054,0.0287595,-0.827279,0.561054,0.0287595,-0.827279,0.561054,0.0287595,-0.681572,0.263225,0.682768,-0.681572,0.263225,0.682768,-0.681572,0.263225,0.682768,-0.562105,0.330445,0.758185,-0.562105,0.330445,0.758185,-0.562105,0.330445,0.758185,0.959765,0.111489,-0.257724,0.959765,0.111489,-0.257724,0.959765,0.111489,-0.257724,0.980513,0.151187,-0.125445,0.980513,0.151187,-0.125445,0.980513,0.151187,-0.125445,0.902748,0.224748,-0.366789,0.902748,0.224748,-0.366789,0.902748,0.224748,-0.366789,0.256687,-0.209499,-0.943516,0.256687,-0.209499,-0.943516,0.256687,-0.209499,-0.943516,-0.720854,-0.420533,-0.550928,-0.720854,-0.420533,-0.550928,-0.720854,-0.420533,-0.550928,0.688177,-0.525728,0.500022,0.688177,-0.525728,0.500022,0.688177,-0.525728,0.500022,-0.331552,-0.137037,0.933431,-0.331552,-0.137037,0.933431,-0.331552,-0.137037,0.933431,0.996674,-0.0784606,0.0220161,0.996674,-0.0784606,0.0220161,0.996674,-0.0784606,0.0220161,-0.834208,0.194341,-0.51607,-0.834208,0.194341,-0.51607,-0.834208,0.194341,-0.51607,-0.837781,-0.545855,0.0128489,-0.837781,-0.545855,0.0128489,-0.837781,-0.545855,0.0128489,-0.271712,-0.613222,0.741708,-0.271712,-0.613222,0.741708,-0.271712,-0.613222,0.741708,0.0698265,-0.868875,0.490082,0.0698265,-0.868875,0.490082,0.0698265,-0.868875,0.490082,0.152847,-0.96753,0.201302,0.152847,-0.96753,0.201302,0.152847,-0.96753,0.201302,0.71583,-0.671201,-0.192553,0.71583,-0.671201,-0.192553,0.71583,-0.671201,-0.192553,0.488311,-0.84056,0.234545,0.488311,-0.84056,0.234545,0.488311,-0.84056,0.234545,0.435918,-0.776784,-0.454513,0.435918,-0.776784,-0.454513,0.435918,-0.776784,-0.454513,-0.774471,-0.627963,0.0765323,-0.774471,-0.627963,0.0765323,-0.774471,-0.627963,0.0765323,-0.0289141,-0.996671,0.076226,-0.0289141,-0.996671,0.076226,-0.0289141,-0.996671,0.076226,0.131777,-0.806603,-0.576217,0.131777,-0.806603,-0.576217,0.131777,-0.806603,-0.576217,-0.167626,-0.930524,-0.325617,-0.167626,-0.930524,-0.325617,-0.167626,-0.930524,-0.325617,-0.888538,-0.375771,-0.263241,-0.888538,-0.375771,-0.263241,-0.888538,-0.375771,-0.263241};
+const GLfloat rock5_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock5_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock5_lod1_numind = 120;
+const GLsizeiptr rock5_lod1_numvert = 120;
+const GLfloat rock5_lod2_vertices[] = {0.00206749,-0.543932,-0.92605,-0.130483,0.211132,-0.887217,0.688944,-0.526313,-0.500546,0.703043,-0.537083,0.510789,0.782107,0.483373,0.568227,-0.300241,0.473884,0.572868,-0.300241,0.473884,0.572868,0.782107,0.483373,0.568227,-0.38808,0.650842,-0.468257,0.782107,0.483373,0.568227,0.276996,0.553992,-0.85249,-0.38808,0.650842,-0.468257,0.276996,0.553992,-0.85249,-0.130483,0.211132,-0.887217,-0.38808,0.650842,-0.468257,-0.91181,0,0.296261,-0.300241,0.473884,0.572868,-0.38808,0.650842,-0.468257,-0.91181,0,0.296261,-0.578104,-0.200289,0.585093,-0.300241,0.473884,0.572868,0.703043,-0.537083,0.510789,0.276996,0.553992,-0.85249,0.782107,0.483373,0.568227,0.703043,-0.537083,0.510789,0.688944,-0.526313,-0.500546,0.276996,0.553992,-0.85249,0.688944,-0.526313,-0.500546,-0.130483,0.211132,-0.887217,0.276996,0.553992,-0.85249,-0.130483,0.211132,-0.887217,-0.91181,0,0.296261,-0.38808,0.650842,-0.468257,-0.578104,-0.200289,0.585093,0.703043,-0.537083,0.510789,-0.300241,0.473884,0.572868,0.00206749,-0.543932,-0.92605,-0.91181,0,0.296261,-0.130483,0.211132,-0.887217,-0.389154,-0.778314,-0.00774249,-0.578104,-0.200289,0.585093,-0.91181,0,0.296261,-0.389154,-0.778314,-0.00774249,0.703043,-0.537083,0.510789,-0.578104,-0.200289,0.585093,-0.389154,-0.778314,-0.00774249,0.158696,-0.830971,-0.488426,0.703043,-0.537083,0.510789,0.158696,-0.830971,-0.488426,0.688944,-0.526313,-0.500546,0.703043,-0.537083,0.510789,0.158696,-0.830971,-0.488426,0.00206749,-0.543932,-0.92605,0.688944,-0.526313,-0.500546,0.158696,-0.830971,-0.488426,-0.389154,-0.778314,-0.00774249,0.00206749,-0.543932,-0.92605,-0.389154,-0.778314,-0.00774249,-0.91181,0,0.296261,0.00206749,-0.543932,-0.92605};
+const GLfloat rock5_lod2_normals[] = {0.519331,0.13457,-0.843911,0.519331,0.13457,-0.843911,0.519331,0.13457,-0.843911,0.00477669,-0.0565659,0.998387,0.00477669,-0.0565659,0.998387,0.00477669,-0.0565659,0.998387,-0.00792084,0.98572,0.168209,-0.00792084,0.98572,0.168209,-0.00792084,0.98572,0.168209,0.143142,0.989701,-0.00169705,0.143142,0.989701,-0.00169705,0.143142,0.989701,-0.00169705,-0.370106,0.517971,-0.771186,-0.370106,0.517971,-0.771186,-0.370106,0.517971,-0.771186,-0.652108,0.736403,0.180183,-0.652108,0.736403,0.180183,-0.652108,0.736403,0.180183,-0.548607,0.24063,0.800704,-0.548607,0.24063,0.800704,-0.548607,0.24063,0.800704,0.940005,-0.0538689,-0.33688,0.940005,-0.0538689,-0.33688,0.940005,-0.0538689,-0.33688,0.935334,0.353646,-0.00927338,0.935334,0.353646,-0.00927338,0.935334,0.353646,-0.00927338,0.256687,-0.209499,-0.943516,0.256687,-0.209499,-0.943516,0.256687,-0.209499,-0.943516,-0.836661,0.0308963,-0.546848,-0.836661,0.0308963,-0.546848,-0.836661,0.0308963,-0.546848,0.0565381,-0.00519786,0.998387,0.0565381,-0.00519786,0.998387,0.0565381,-0.00519786,0.998387,-0.819446,-0.114974,-0.561506,-0.819446,-0.114974,-0.561506,-0.819446,-0.114974,-0.561506,-0.694193,-0.613319,0.376744,-0.694193,-0.613319,0.376744,-0.694193,-0.613319,0.376744,-0.153783,-0.731529,0.664241,-0.153783,-0.731529,0.664241,-0.153783,-0.731529,0.664241,0.106077,-0.968112,0.226952,0.106077,-0.968112,0.226952,0.106077,-0.968112,0.226952,0.49784,-0.867118,-0.0161746,0.49784,-0.867118,-0.0161746,0.49784,-0.867118,-0.0161746,0.388756,-0.70043,-0.598553,0.388756,-0.70043,-0.598553,0.388756,-0.70043,-0.598553,-0.419426,-0.820628,-0.388137,-0.419426,-0.820628,-0.388137,-0.419426,-0.820628,-0.388137,-0.814837,-0.374279,-0.442669,-0.814837,-0.374279,-0.442669,-0.814837,-0.374279,-0.442669};
+const GLfloat rock5_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.4,0.416,0.416,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock5_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock5_lod2_numind = 60;
+const GLsizeiptr rock5_lod2_numvert = 60;
+
+#endif
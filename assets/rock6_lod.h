@@ -0,0 +1,18 @@
+
+#ifndef rock6_lod_H
+#define rock6_lod_H
+
+const GLfloat rock6_lod1_vertices[] = {0.205033,-0.70675,0,-0.259486,-0.518972,-0.423603,0.121843,-0.637994,-0.374999,-0.97958,0,-0.31828,-0.259486,-0.518972,-0.423603,-0.33791,-0.675822,0.245503,0.205033,-0.70675,0,0.130826,-0.685033,0.402648,-0.33791,-0.675822,0.245503,0.867951,-0.433978,0,0.577071,0,-0.419263,0.634089,0.391896,0.460687,0.361721,-0.364861,0.506495,0.634089,0.391896,0.460687,0,0,0.840623,0.782725,0.483758,0,0.197155,0.39431,-0.606766,0.318996,0.637994,-0.231761,-0.978489,0.489246,0,-0.713296,0,0.231763,-0.543457,0.879336,0,-0.543457,0.879336,0,-0.177657,0.930252,0.546781,0.318996,0.637994,-0.231761,-0.543457,0.879336,0,-0.713296,0,0.231763,-0.177657,0.930252,0.546781,-0.713296,0,0.231763,-0.268866,0.435049,0.827499,-0.177657,0.930252,0.546781,-0.177657,0.930252,0.546781,0.782725,0.483758,0,0.318996,0.637994,-0.231761,-0.177657,0.930252,0.546781,-0.268866,0.435049,0.827499,0.782725,0.483758,0,-0.268866,0.435049,0.827499,0.634089,0.391896,0.460687,0.782725,0.483758,0,0.318996,0.637994,-0.231761,0.197155,0.39431,-0.606766,-0.543457,0.879336,0,0.197155,0.39431,-0.606766,-0.207294,0.335415,-0.637989,-0.543457,0.879336,0,-0.207294,0.335415,-0.637989,-0.978489,0.489246,0,-0.543457,0.879336,0,-0.539609,0,0.742704,-0.268866,0.435049,0.827499,-0.713296,0,0.231763,0,0,0.840623,0.634089,0.391896,0.460687,-0.268866,0.435049,0.827499,0.634089,0.391896,0.460687,0.577071,0,-0.419263,0.782725,0.483758,0,0.577071,0,-0.419263,0.197155,0.39431,-0.606766,0.782725,0.483758,0,0.577071,0,-0.419263,0,0,-0.877914,0.197155,0.39431,-0.606766,0,0,-0.877914,-0.207294,0.335415,-0.637989,0.197155,0.39431,-0.606766,0,0,-0.877914,-0.97958,0,-0.31828,-0.207294,0.335415,-0.637989,-0.97958,0,-0.31828,-0.978489,0.489246,0,-0.207294,0.335415,-0.637989,-0.539609,0,0.742704,0,0,0.840623,-0.268866,0.435049,0.827499,-0.539609,0,0.742704,0.130826,-0.685033,0.402648,0,0,0.840623,0.130826,-0.685033,0.402648,0.361721,-0.364861,0.506495,0,0,0.840623,0.361721,-0.364861,0.506495,0.867951,-0.433978,0,0.634089,0.391896,0.460687,0.867951,-0.433978,0,0,0,-0.877914,0.577071,0,-0.419263,-0.259486,-0.518972,-0.423603,-0.97958,0,-0.31828,0,0,-0.877914,-0.97958,0,-0.31828,-0.713296,0,0.231763,-0.978489,0.489246,0,-0.97958,0,-0.31828,-0.33791,-0.675822,0.245503,-0.713296,0,0.231763,-0.33791,-0.675822,0.245503,-0.539609,0,0.742704,-0.713296,0,0.231763,-0.33791,-0.675822,0.245503,0.130826,-0.685033,0.402648,-0.539609,0,0.742704,0.130826,-0.685033,0.402648,0.205033,-0.70675,0,0.361721,-0.364861,0.506495,0.205033,-0.70675,0,0.867951,-0.433978,0,0.361721,-0.364861,0.506495,0.205033,-0.70675,0,0.121843,-0.637994,-0.374999,0.867951,-0.433978,0,0.121843,-0.637994,-0.374999,0,0,-0.877914,0.867951,-0.433978,0,-0.259486,-0.518972,-0.423603,0.205033,-0.70675,0,-0.33791,-0.675822,0.245503,0.121843,-0.637994,-0.374999,-0.259486,-0.518972,-0.423603,0,0,-0.877914};
+const GLfloat rock6_lod1_normals[] = {-0.283059,-0.952557,-0.111857,-0.283059,-0.952557,-0.111857,-0.283059,-0.952557,-0.111857,-0.589959,-0.768021,-0.249185,-0.589959,-0.768021,-0.249185,-0.589959,-0.768021,-0.249185,-0.0354749,-0.99825,0.0473032,-0.0354749,-0.99825,0.0473032,-0.0354749,-0.99825,0.0473032,0.89621,0.380766,-0.22765,0.89621,0.380766,-0.22765,0.89621,0.380766,-0.22765,0.57812,-0.159637,0.800183,0.57812,-0.159637,0.800183,0.57812,-0.159637,0.800183,0.502975,0.640898,-0.579884,0.502975,0.640898,-0.579884,0.502975,0.640898,-0.579884,-0.26277,0.293044,0.919281,-0.26277,0.293044,0.919281,-0.26277,0.293044,0.919281,0.205639,0.952119,-0.226235,0.205639,0.952119,-0.226235,0.205639,0.952119,-0.226235,-0.807447,0.291182,0.513072,-0.807447,0.291182,0.513072,-0.807447,0.291182,0.513072,-0.853929,0.366631,0.369306,-0.853929,0.366631,0.369306,-0.853929,0.366631,0.369306,0.364529,0.924141,-0.114372,0.364529,0.924141,-0.114372,0.364529,0.924141,-0.114372,0.576706,0.319906,0.751712,0.576706,0.319906,0.751712,0.576706,0.319906,0.751712,0.142423,0.960877,0.237552,0.142423,0.960877,0.237552,0.142423,0.960877,0.237552,0.079715,0.823814,-0.561227,0.079715,0.823814,-0.561227,0.079715,0.823814,-0.561227,-0.057104,0.744682,-0.664972,-0.057104,0.744682,-0.664972,-0.057104,0.744682,-0.664972,-0.475262,0.530016,-0.702288,-0.475262,0.530016,-0.702288,-0.475262,0.530016,-0.702288,-0.837775,0.465862,0.28479,-0.837775,0.465862,0.28479,-0.837775,0.465862,0.28479,0.374174,0.258115,0.890713,0.374174,0.258115,0.890713,0.374174,0.258115,0.890713,0.844487,-0.507449,0.171279,0.844487,-0.507449,0.171279,0.844487,-0.507449,0.171279,0.66043,0.311414,-0.683267,0.66043,0.311414,-0.683267,0.66043,0.311414,-0.683267,0.606738,0.22158,-0.763394,0.606738,0.22158,-0.763394,0.606738,0.22158,-0.763394,-0.0202606,0.573356,-0.819056,-0.0202606,0.573356,-0.819056,-0.0202606,0.573356,-0.819056,-0.473201,0.300032,-0.828288,-0.473201,0.300032,-0.828288,-0.473201,0.300032,-0.828288,-0.504299,0.471684,-0.723323,-0.504299,0.471684,-0.723323,-0.504299,0.471684,-0.723323,-0.177969,-0.0804012,0.980746,-0.177969,-0.0804012,0.980746,-0.177969,-0.0804012,0.980746,-0.1488,-0.552683,0.82,-0.1488,-0.552683,0.82,-0.1488,-0.552683,0.82,0.286985,-0.476501,0.831015,0.286985,-0.476501,0.831015,0.286985,-0.476501,0.831015,0.678878,-0.2016,0.706033,0.678878,-0.2016,0.706033,0.678878,-0.2016,0.706033,0.589218,-0.321282,-0.74135,0.589218,-0.321282,-0.74135,0.589218,-0.321282,-0.74135,-0.441531,-0.455795,-0.772853,-0.441531,-0.455795,-0.772853,-0.441531,-0.455795,-0.772853,-0.866408,-0.270936,0.419441,-0.866408,-0.270936,0.419441,-0.866408,-0.270936,0.419441,-0.807909,-0.440802,0.391121,-0.807909,-0.440802,0.391121,-0.807909,-0.440802,0.391121,-0.840232,-0.460901,0.285625,-0.840232,-0.460901,0.285625,-0.840232,-0.460901,0.285625,-0.260003,-0.621368,0.739121,-0.260003,-0.621368,0.739121,-0.260003,-0.621368,0.739121,0.770742,-0.612619,0.175088,0.770742,-0.612619,0.175088,0.770742,-0.612619,0.175088,0.339457,-0.824982,0.451856,0.339457,-0.824982,0.451856,0.339457,-0.824982,0.451856,0.36881,-0.896318,-0.246157,0.36881,-0.896318,-0.246157,0.36881,-0.896318,-0.246157,0.495316,-0.477477,-0.725726,0.495316,-0.477477,-0.725726,0.495316,-0.477477,-0.725726,-0.164489,-0.955887,-0.243356,-0.164489,-0.955887,-0.243356,-0.164489,-0.955887,-0.243356,-0.0974071,-0.627527,-0.772477,-0.0974071,-0.627527,-0.772477,-0.0974071,-0.627527,-0.772477};
+const GLfloat rock6_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock6_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock6_lod1_numind = 120;
+const GLsizeiptr rock6_lod1_numvert = 120;
+const GLfloat rock6_lod2_vertices[] = {-0.97958,0,-0.31828,-0.259486,-0.518972,-0.423603,-0.33791,-0.675822,0.245503,0.163438,-0.672372,-0.187499,0.130826,-0.685033,0.402648,-0.33791,-0.675822,0.245503,0.130826,-0.685033,0.402648,0.634089,0.391896,0.460687,-0.134433,0.217524,0.834061,-0.97958,0,-0.31828,-0.539609,0,0.742704,-0.360557,0.904794,0.273391,-0.539609,0,0.742704,-0.134433,0.217524,0.834061,-0.360557,0.904794,0.273391,-0.360557,0.904794,0.273391,-0.134433,0.217524,0.834061,0.782725,0.483758,0,-0.134433,0.217524,0.834061,0.634089,0.391896,0.460687,0.782725,0.483758,0,0.782725,0.483758,0,0,0,-0.877914,-0.360557,0.904794,0.273391,0,0,-0.877914,-0.97958,0,-0.31828,-0.360557,0.904794,0.273391,0.634089,0.391896,0.460687,0.722511,-0.216989,-0.209632,0.782725,0.483758,0,0.722511,-0.216989,-0.209632,0,0,-0.877914,0.782725,0.483758,0,-0.539609,0,0.742704,0.130826,-0.685033,0.402648,-0.134433,0.217524,0.834061,0.130826,-0.685033,0.402648,0.722511,-0.216989,-0.209632,0.634089,0.391896,0.460687,-0.259486,-0.518972,-0.423603,-0.97958,0,-0.31828,0,0,-0.877914,-0.97958,0,-0.31828,-0.33791,-0.675822,0.245503,-0.539609,0,0.742704,-0.33791,-0.675822,0.245503,0.130826,-0.685033,0.402648,-0.539609,0,0.742704,0.163438,-0.672372,-0.187499,0.722511,-0.216989,-0.209632,0.130826,-0.685033,0.402648,0.163438,-0.672372,-0.187499,0,0,-0.877914,0.722511,-0.216989,-0.209632,-0.259486,-0.518972,-0.423603,0.163438,-0.672372,-0.187499,-0.33791,-0.675822,0.245503,0.163438,-0.672372,-0.187499,-0.259486,-0.518972,-0.423603,0,0,-0.877914};
+const GLfloat rock6_lod2_normals[] = {-0.589959,-0.768021,-0.249185,-0.589959,-0.768021,-0.249185,-0.589959,-0.768021,-0.249185,-0.0122277,-0.99968,-0.0221229,-0.0122277,-0.99968,-0.0221229,-0.0122277,-0.99968,-0.0221229,0.469333,-0.264725,0.842405,0.469333,-0.264725,0.842405,0.469333,-0.264725,0.842405,-0.863058,0.356431,0.357894,-0.863058,0.356431,0.357894,-0.863058,0.356431,0.357894,-0.430535,0.481258,0.763564,-0.430535,0.481258,0.763564,-0.430535,0.481258,0.763564,0.395247,0.655233,0.643777,0.395247,0.655233,0.643777,0.395247,0.655233,0.643777,-0.150743,0.977685,0.146317,-0.150743,0.977685,0.146317,-0.150743,0.977685,0.146317,0.155909,0.799773,-0.579704,0.155909,0.799773,-0.579704,0.155909,0.799773,-0.579704,-0.3674,0.671898,-0.643095,-0.3674,0.671898,-0.643095,-0.3674,0.671898,-0.643095,0.947978,-0.163219,0.273309,0.947978,-0.163219,0.273309,0.947978,-0.163219,0.273309,0.695267,0.150508,-0.702816,0.695267,0.150508,-0.702816,0.695267,0.150508,-0.702816,0.0243341,-0.425298,0.904726,0.0243341,-0.425298,0.904726,0.0243341,-0.425298,0.904726,0.792775,-0.39547,0.463801,0.792775,-0.39547,0.463801,0.792775,-0.39547,0.463801,-0.441531,-0.455795,-0.772853,-0.441531,-0.455795,-0.772853,-0.441531,-0.455795,-0.772853,-0.806816,-0.486938,0.334572,-0.806816,-0.486938,0.334572,-0.806816,-0.486938,0.334572,-0.260003,-0.621368,0.739121,-0.260003,-0.621368,0.739121,-0.260003,-0.621368,0.739121,0.631871,-0.774858,0.0182938,0.631871,-0.774858,0.0182938,0.631871,-0.774858,0.0182938,0.449352,-0.584504,-0.675602,0.449352,-0.584504,-0.675602,0.449352,-0.584504,-0.675602,-0.206088,-0.947064,-0.246163,-0.206088,-0.947064,-0.246163,-0.206088,-0.947064,-0.246163,0.14422,-0.691635,-0.707701,0.14422,-0.691635,-0.707701,0.14422,-0.691635,-0.707701};
+const GLfloat rock6_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock6_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock6_lod2_numind = 60;
+const GLsizeiptr rock6_lod2_numvert = 60;
+
+#endif
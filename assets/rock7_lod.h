@@ -0,0 +1,18 @@
+
+#ifndef rock7_lod_H
+#define rock7_lod_H
+
+const GLfloat rock7_lod1_vertices[] = {0,-1.14745,0,-0.459992,-0.919996,-0.3342,0.168179,-0.880625,-0.517611,-0.319245,-0.638491,-0.98252,-0.459992,-0.919996,-0.3342,-1.04506,-0.645883,0,-0.319245,-0.638491,-0.98252,-1.04506,-0.645883,0,-0.682509,0.521397,-0.49587,0.168179,-0.880625,-0.517611,-0.319245,-0.638491,-0.98252,0,0,-1.14745,0.745662,-0.459677,0.23905,0.168179,-0.880625,-0.517611,1.14126,0,-0.370808,0.316283,-0.511776,0.973439,0.745662,-0.459677,0.23905,0.688585,0,0.947761,0.168179,-0.880625,-0.517611,0,0,-1.14745,1.14126,0,-0.370808,0.745662,-0.459677,0.23905,1.14126,0,-0.370808,0.872003,0,0.283327,0.316283,-0.511776,0.973439,0.688585,0,0.947761,-0.69738,0,0.959867,-0.275161,-0.550322,0.846843,-0.69738,0,0.959867,-1.14374,0,0.371616,0,0,-1.14745,-0.682509,0.521397,-0.49587,-0.194361,1.01772,-0.598192,1.14126,0,-0.370808,0.252324,0.504648,-0.776559,-0.194361,1.01772,-0.598192,-0.562614,0.910333,0,-0.179633,0.940603,0.552864,-0.194361,1.01772,-0.598192,-0.562614,0.910333,0,-0.869867,0.434936,0,-0.179633,0.940603,0.552864,-0.869867,0.434936,0,0.284019,0.568038,0.874105,-0.179633,0.940603,0.552864,-0.179633,0.940603,0.552864,0.614206,0.655554,0.145072,-0.194361,1.01772,-0.598192,-0.179633,0.940603,0.552864,0.284019,0.568038,0.874105,0.614206,0.655554,0.145072,0.284019,0.568038,0.874105,0.872003,0,0.283327,0.614206,0.655554,0.145072,0.614206,0.655554,0.145072,1.14126,0,-0.370808,-0.194361,1.01772,-0.598192,0.252324,0.504648,-0.776559,0,0,-1.14745,-0.194361,1.01772,-0.598192,-0.194361,1.01772,-0.598192,-0.682509,0.521397,-0.49587,-0.562614,0.910333,0,-0.682509,0.521397,-0.49587,-0.869867,0.434936,0,-0.562614,0.910333,0,-1.14374,0,0.371616,-0.69738,0,0.959867,-0.869867,0.434936,0,-0.69738,0,0.959867,0.284019,0.568038,0.874105,-0.869867,0.434936,0,-0.69738,0,0.959867,0.688585,0,0.947761,0.284019,0.568038,0.874105,0.688585,0,0.947761,0.872003,0,0.283327,0.284019,0.568038,0.874105,0.872003,0,0.283327,1.14126,0,-0.370808,0.614206,0.655554,0.145072,1.14126,0,-0.370808,0,0,-1.14745,0.252324,0.504648,-0.776559,-0.275161,-0.550322,0.846843,0.316283,-0.511776,0.973439,-0.69738,0,0.959867,0.688585,0,0.947761,0.745662,-0.459677,0.23905,0.872003,0,0.283327,0,0,-1.14745,-0.319245,-0.638491,-0.98252,-0.682509,0.521397,-0.49587,-0.682509,0.521397,-0.49587,-1.14374,0,0.371616,-0.869867,0.434936,0,-0.682509,0.521397,-0.49587,-1.04506,-0.645883,0,-1.14374,0,0.371616,-1.04506,-0.645883,0,-0.275161,-0.550322,0.846843,-1.14374,0,0.371616,-1.04506,-0.645883,0,0,-1.14745,0,-0.275161,-0.550322,0.846843,0,-1.14745,0,0.316283,-0.511776,0.973439,-0.275161,-0.550322,0.846843,0,-1.14745,0,0.745662,-0.459677,0.23905,0.316283,-0.511776,0.973439,0,-1.14745,0,0.168179,-0.880625,-0.517611,0.745662,-0.459677,0.23905,-0.459992,-0.919996,-0.3342,0,-1.14745,0,-1.04506,-0.645883,0,0.168179,-0.880625,-0.517611,-0.459992,-0.919996,-0.3342,-0.319245,-0.638491,-0.98252};
+const GLfloat rock7_lod1_normals[] = {-0.084829,-0.874156,-0.47818,-0.084829,-0.874156,-0.47818,-0.084829,-0.874156,-0.47818,-0.572229,-0.69956,-0.427982,-0.572229,-0.69956,-0.427982,-0.572229,-0.69956,-0.427982,-0.804321,-0.00260225,-0.59419,-0.804321,-0.00260225,-0.59419,-0.804321,-0.00260225,-0.59419,0.495058,-0.440917,-0.748672,0.495058,-0.440917,-0.748672,0.495058,-0.440917,-0.748672,0.676012,-0.728539,-0.110628,0.676012,-0.728539,-0.110628,0.676012,-0.728539,-0.110628,0.750148,-0.525575,0.401308,0.750148,-0.525575,0.401308,0.750148,-0.525575,0.401308,0.506435,-0.435543,-0.744195,0.506435,-0.435543,-0.744195,0.506435,-0.435543,-0.744195,0.887939,-0.279251,0.365489,0.887939,-0.279251,0.365489,0.887939,-0.279251,0.365489,0.008726,0.0437763,0.999003,0.008726,0.0437763,0.999003,0.008726,0.0437763,0.999003,-0.64179,-0.592411,0.486985,-0.64179,-0.592411,0.486985,-0.64179,-0.592411,0.486985,-0.505473,0.333048,-0.795975,-0.505473,0.333048,-0.795975,-0.505473,0.333048,-0.795975,0.587533,0.669511,-0.454489,0.587533,0.669511,-0.454489,0.587533,0.669511,-0.454489,-0.17585,0.982062,0.0680459,-0.17585,0.982062,0.0680459,-0.17585,0.982062,0.0680459,-0.735253,0.4752,0.483308,-0.735253,0.4752,0.483308,-0.735253,0.4752,0.483308,-0.59875,-0.0562398,0.798959,-0.59875,-0.0562398,0.798959,-0.59875,-0.0562398,0.798959,0.363486,0.929814,0.0576445,0.363486,0.929814,0.0576445,0.363486,0.929814,0.0576445,0.457507,0.834391,0.307374,0.457507,0.834391,0.307374,0.457507,0.834391,0.307374,0.812512,0.407446,0.416907,0.812512,0.407446,0.416907,0.812512,0.407446,0.416907,0.609367,0.731203,-0.306616,0.609367,0.731203,-0.306616,0.609367,0.731203,-0.306616,0.236114,0.496046,-0.835576,0.236114,0.496046,-0.835576,0.236114,0.496046,-0.835576,-0.70726,0.629132,-0.322454,-0.70726,0.629132,-0.322454,-0.70726,0.629132,-0.322454,-0.819778,0.529829,-0.21736,-0.819778,0.529829,-0.21736,-0.819778,0.529829,-0.21736,-0.558226,0.713418,0.423577,-0.558226,0.713418,0.423577,-0.558226,0.713418,0.423577,-0.421978,0.794879,0.436006,-0.421978,0.794879,0.436006,-0.421978,0.794879,0.436006,0.00865484,0.134646,0.990856,0.00865484,0.134646,0.990856,0.00865484,0.134646,0.990856,0.781888,0.584861,0.215842,0.781888,0.584861,0.215842,0.781888,0.584861,0.215842,0.845189,0.405741,0.347893,0.845189,0.405741,0.347893,0.845189,0.405741,0.347893,0.534847,0.310204,-0.785946,0.534847,0.310204,-0.785946,0.534847,0.310204,-0.785946,-0.177404,-0.326762,0.928307,-0.177404,-0.326762,0.928307,-0.177404,-0.326762,0.928307,0.925661,-0.279027,0.25553,0.925661,-0.279027,0.25553,0.925661,-0.279027,0.25553,-0.635613,0.120848,-0.76249,-0.635613,0.120848,-0.76249,-0.635613,0.120848,-0.76249,-0.901957,0.325222,-0.284086,-0.901957,0.325222,-0.284086,-0.901957,0.325222,-0.284086,-0.902553,0.102689,-0.418155,-0.902553,0.102689,-0.418155,-0.902553,0.102689,-0.418155,-0.63196,-0.456781,0.626081,-0.63196,-0.456781,0.626081,-0.63196,-0.456781,0.626081,-0.387764,-0.807941,0.443701,-0.387764,-0.807941,0.443701,-0.387764,-0.807941,0.443701,-0.0661853,-0.825471,0.560551,-0.0661853,-0.825471,0.560551,-0.0661853,-0.825471,0.560551,0.595056,-0.747634,0.294876,0.595056,-0.747634,0.294876,0.595056,-0.747634,0.294876,0.695045,-0.705616,-0.137908,0.695045,-0.705616,-0.137908,0.695045,-0.705616,-0.137908,-0.432618,-0.901397,-0.0180248,-0.432618,-0.901397,-0.0180248,-0.432618,-0.901397,-0.0180248,-0.0623131,-0.910468,-0.408859,-0.0623131,-0.910468,-0.408859,-0.0623131,-0.910468,-0.408859};
+const GLfloat rock7_lod1_colors[] = {0.463,0.475,0.475,0.463,0.475,0.475,0.463,0.475,0.475,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.451,0.463,0.463,0.451,0.463,0.463,0.451,0.463,0.463,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.439,0.455,0.455,0.439,0.455,0.455,0.439,0.455,0.455,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock7_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock7_lod1_numind = 120;
+const GLsizeiptr rock7_lod1_numvert = 120;
+const GLfloat rock7_lod2_vertices[] = {0,-1.14745,0,-0.389619,-0.779243,-0.65836,0.168179,-0.880625,-0.517611,-0.389619,-0.779243,-0.65836,-1.0944,-0.322942,0.185808,-0.699375,0.597016,-0.247935,0.168179,-0.880625,-0.517611,-0.389619,-0.779243,-0.65836,0,0,-1.14745,0.168179,-0.880625,-0.517611,0,0,-1.14745,1.14126,0,-0.370808,0,0,-1.14745,-0.699375,0.597016,-0.247935,-0.194361,1.01772,-0.598192,-0.699375,0.597016,-0.247935,0.052193,0.754321,0.713485,-0.194361,1.01772,-0.598192,0.052193,0.754321,0.713485,0.614206,0.655554,0.145072,-0.194361,1.01772,-0.598192,0.052193,0.754321,0.713485,1.14126,0,-0.370808,0.614206,0.655554,0.145072,0.614206,0.655554,0.145072,1.14126,0,-0.370808,-0.194361,1.01772,-0.598192,-1.0944,-0.322942,0.185808,-0.69738,0,0.959867,-0.699375,0.597016,-0.247935,-0.69738,0,0.959867,0.052193,0.754321,0.713485,-0.699375,0.597016,-0.247935,-0.69738,0,0.959867,0.502434,-0.255888,0.9606,0.052193,0.754321,0.713485,0.502434,-0.255888,0.9606,1.14126,0,-0.370808,0.052193,0.754321,0.713485,1.14126,0,-0.370808,0,0,-1.14745,-0.194361,1.01772,-0.598192,0,0,-1.14745,-0.389619,-0.779243,-0.65836,-0.699375,0.597016,-0.247935,-1.0944,-0.322942,0.185808,0,-1.14745,0,-0.69738,0,0.959867,0,-1.14745,0,0.502434,-0.255888,0.9606,-0.69738,0,0.959867,0,-1.14745,0,1.14126,0,-0.370808,0.502434,-0.255888,0.9606,0,-1.14745,0,0.168179,-0.880625,-0.517611,1.14126,0,-0.370808,-0.389619,-0.779243,-0.65836,0,-1.14745,0,-1.0944,-0.322942,0.185808};
+const GLfloat rock7_lod2_normals[] = {-0.0421479,-0.882419,-0.468572,-0.0421479,-0.882419,-0.468572,-0.0421479,-0.882419,-0.468572,-0.761653,0.0217062,-0.647622,-0.761653,0.0217062,-0.647622,-0.761653,0.0217062,-0.647622,0.103702,-0.565424,-0.818255,0.103702,-0.565424,-0.818255,0.103702,-0.565424,-0.818255,0.506435,-0.435543,-0.744195,0.506435,-0.435543,-0.744195,0.506435,-0.435543,-0.744195,-0.681204,0.242673,-0.690703,-0.681204,0.242673,-0.690703,-0.681204,0.242673,-0.690703,-0.50508,0.822918,0.260191,-0.50508,0.822918,0.260191,-0.50508,0.822918,0.260191,0.300623,0.944404,0.13314,0.300623,0.944404,0.13314,0.300623,0.944404,0.13314,0.712791,0.0213833,0.70105,0.712791,0.0213833,0.70105,0.712791,0.0213833,0.70105,0.609367,0.731203,-0.306616,0.609367,0.731203,-0.306616,0.609367,0.731203,-0.306616,-0.847464,0.475332,0.236356,-0.847464,0.475332,0.236356,-0.847464,0.475332,0.236356,-0.602885,0.714826,0.354334,-0.602885,0.714826,0.354334,-0.602885,0.714826,0.354334,0.0549224,0.260283,0.963969,0.0549224,0.260283,0.963969,0.0549224,0.260283,0.963969,0.766701,0.452997,0.454933,0.766701,0.452997,0.454933,0.766701,0.452997,0.454933,0.492205,0.48435,-0.723284,0.492205,0.48435,-0.723284,0.492205,0.48435,-0.723284,-0.78729,0.00666914,-0.616547,-0.78729,0.00666914,-0.616547,-0.78729,0.00666914,-0.616547,-0.450707,-0.717826,0.53065,-0.450707,-0.717826,0.53065,-0.450707,-0.717826,0.53065,-0.146658,-0.68561,0.713043,-0.146658,-0.68561,0.713043,-0.146658,-0.68561,0.713043,0.72624,-0.65009,0.223513,0.72624,-0.65009,0.223513,0.72624,-0.65009,0.223513,0.675713,-0.721269,-0.152258,0.675713,-0.721269,-0.152258,0.675713,-0.721269,-0.152258,-0.608511,-0.789365,-0.0813545,-0.608511,-0.789365,-0.0813545,-0.608511,-0.789365,-0.0813545};
+const GLfloat rock7_lod2_colors[] = {0.463,0.475,0.475,0.463,0.475,0.475,0.463,0.475,0.475,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.439,0.455,0.455,0.439,0.455,0.455,0.439,0.455,0.455,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock7_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock7_lod2_numind = 60;
+const GLsizeiptr rock7_lod2_numvert = 60;
+
+#endif
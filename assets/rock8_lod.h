@@ -0,0 +1,18 @@
+
+#ifndef rock8_lod_H
+#define rock8_lod_H
+
+const GLfloat rock8_lod1_vertices[] = {0.182005,-0.953024,-0.560165,0.546029,-0.883498,0,0.176385,-0.923595,0.542868,0.182005,-0.953024,-0.560165,0.176385,-0.923595,0.542868,-0.669012,-0.731472,0.167176,-0.585965,-0.655315,-0.425723,-0.669012,-0.731472,0.167176,-1.0421,0,-0.338593,0.176385,-0.923595,0.542868,0.71857,-0.548945,0.52207,0.297532,0,0.914403,-0.585965,-0.655315,-0.425723,-1.0421,0,-0.338593,-0.275282,0.44543,-0.847244,0.75883,-0.579701,-0.551321,0.757275,0.468027,-0.550186,0.952525,0,0.309489,-0.669012,-0.731472,0.167176,-0.654765,0,0.90121,-0.953509,0,0.309809,-0.275282,0.44543,-0.847244,-1.0421,0,-0.338593,-0.186278,0.975399,-0.573317,0.757275,0.468027,-0.550186,0.286319,0.572637,-0.881183,0.203426,0.90808,-0.147796,-1.0421,0,-0.338593,-0.704289,0.538035,0.511694,-0.541422,0.876043,0,-0.541422,0.876043,0,0.0417165,0.687492,0.642219,0.203426,0.90808,-0.147796,-0.541422,0.876043,0,-0.704289,0.538035,0.511694,0.0417165,0.687492,0.642219,0.0417165,0.687492,0.642219,0.554499,0.621985,0.402862,0.203426,0.90808,-0.147796,0.554499,0.621985,0.402862,0.757275,0.468027,-0.550186,0.203426,0.90808,-0.147796,0.203426,0.90808,-0.147796,0.286319,0.572637,-0.881183,-0.186278,0.975399,-0.573317,0.286319,0.572637,-0.881183,-0.275282,0.44543,-0.847244,-0.186278,0.975399,-0.573317,-0.186278,0.975399,-0.573317,-0.541422,0.876043,0,0.203426,0.90808,-0.147796,-0.186278,0.975399,-0.573317,-1.0421,0,-0.338593,-0.541422,0.876043,0,-0.953509,0,0.309809,-0.704289,0.538035,0.511694,-1.0421,0,-0.338593,-0.953509,0,0.309809,-0.654765,0,0.90121,-0.704289,0.538035,0.511694,0.297532,0,0.914403,0.0417165,0.687492,0.642219,-0.704289,0.538035,0.511694,0.297532,0,0.914403,0.554499,0.621985,0.402862,0.0417165,0.687492,0.642219,0.952525,0,0.309489,0.757275,0.468027,-0.550186,0.554499,0.621985,0.402862,0.136183,-0.220355,-0.920419,0.286319,0.572637,-0.881183,0.757275,0.468027,-0.550186,0.136183,-0.220355,-0.920419,-0.275282,0.44543,-0.847244,0.286319,0.572637,-0.881183,-0.654765,0,0.90121,0.297532,0,0.914403,-0.704289,0.538035,0.511694,-0.654765,0,0.90121,0.176385,-0.923595,0.542868,0.297532,0,0.914403,0.297532,0,0.914403,0.952525,0,0.309489,0.554499,0.621985,0.402862,0.297532,0,0.914403,0.71857,-0.548945,0.52207,0.952525,0,0.309489,0.71857,-0.548945,0.52207,0.75883,-0.579701,-0.551321,0.952525,0,0.309489,0.757275,0.468027,-0.550186,0.75883,-0.579701,-0.551321,0.136183,-0.220355,-0.920419,0.136183,-0.220355,-0.920419,-0.585965,-0.655315,-0.425723,-0.275282,0.44543,-0.847244,-1.0421,0,-0.338593,-0.669012,-0.731472,0.167176,-0.953509,0,0.309809,-0.669012,-0.731472,0.167176,0.176385,-0.923595,0.542868,-0.654765,0,0.90121,0.176385,-0.923595,0.542868,0.546029,-0.883498,0,0.71857,-0.548945,0.52207,0.546029,-0.883498,0,0.75883,-0.579701,-0.551321,0.71857,-0.548945,0.52207,0.546029,-0.883498,0,0.182005,-0.953024,-0.560165,0.75883,-0.579701,-0.551321,0.182005,-0.953024,-0.560165,0.136183,-0.220355,-0.920419,0.75883,-0.579701,-0.551321,-0.585965,-0.655315,-0.425723,0.182005,-0.953024,-0.560165,-0.669012,-0.731472,0.167176,0.182005,-0.953024,-0.560165,-0.585965,-0.655315,-0.425723,0.136183,-0.220355,-0.920419};
+const GLfloat rock8_lod1_normals[] = {0.147097,-0.98875,0.0271294,0.147097,-0.98875,0.0271294,0.147097,-0.98875,0.0271294,-0.23199,-0.972403,0.0247618,-0.23199,-0.972403,0.0247618,-0.23199,-0.972403,0.0247618,-0.817986,-0.544828,-0.184558,-0.817986,-0.544828,-0.184558,-0.817986,-0.544828,-0.184558,0.302586,-0.389607,0.869855,0.302586,-0.389607,0.869855,0.302586,-0.389607,0.869855,-0.456766,-0.202771,-0.866169,-0.456766,-0.202771,-0.866169,-0.456766,-0.202771,-0.866169,0.975361,0.00168661,-0.220607,0.975361,0.00168661,-0.220607,0.975361,0.00168661,-0.220607,-0.818472,-0.398955,0.413448,-0.818472,-0.398955,0.413448,-0.818472,-0.398955,0.413448,-0.659051,0.42972,-0.617246,-0.659051,0.42972,-0.617246,-0.659051,0.42972,-0.617246,0.423496,0.840969,-0.336783,0.423496,0.840969,-0.336783,0.423496,0.840969,-0.336783,-0.874254,0.483712,0.0412575,-0.874254,0.483712,0.0412575,-0.874254,0.483712,0.0412575,0.0124319,0.962422,0.271272,0.0124319,0.962422,0.271272,0.0124319,0.962422,0.271272,-0.252094,0.84241,0.476229,-0.252094,0.84241,0.476229,-0.252094,0.84241,0.476229,0.260983,0.91462,0.308801,0.260983,0.91462,0.308801,0.260983,0.91462,0.308801,0.62515,0.780474,0.0069301,0.62515,0.780474,0.0069301,0.62515,0.780474,0.0069301,0.486927,0.813813,-0.317193,0.486927,0.813813,-0.317193,0.486927,0.813813,-0.317193,-0.159754,0.474309,-0.865742,-0.159754,0.474309,-0.865742,-0.159754,0.474309,-0.865742,-0.00969793,0.986261,0.164912,-0.00969793,0.986261,0.164912,-0.00969793,0.986261,0.164912,-0.742158,0.564068,-0.36198,-0.742158,0.564068,-0.36198,-0.742158,0.564068,-0.36198,-0.917331,0.377881,0.125338,-0.917331,0.377881,0.125338,-0.917331,0.377881,0.125338,-0.86709,0.237287,0.438007,-0.86709,0.237287,0.438007,-0.86709,0.237287,0.438007,-0.220595,0.286979,0.932191,-0.220595,0.286979,0.932191,-0.220595,0.286979,0.932191,0.42252,0.465185,0.777869,0.42252,0.465185,0.777869,0.42252,0.465185,0.777869,0.844907,0.52646,0.0947212,0.844907,0.52646,0.0947212,0.844907,0.52646,0.0947212,0.563895,-0.0660311,-0.823202,0.563895,-0.0660311,-0.823202,0.563895,-0.0660311,-0.823202,-0.074491,0.0633446,-0.995208,-0.074491,0.0633446,-0.995208,-0.074491,0.0633446,-0.995208,-0.0112279,0.5857,0.81045,-0.0112279,0.5857,0.81045,-0.0112279,0.5857,0.81045,-0.0128599,-0.371723,0.928255,-0.0128599,-0.371723,0.928255,-0.0128599,-0.371723,0.928255,0.645454,0.308126,0.69889,0.645454,0.308126,0.69889,0.645454,0.308126,0.69889,0.678457,-0.0046658,0.734625,0.678457,-0.0046658,0.734625,0.678457,-0.0046658,0.734625,0.925217,-0.3767,0.0454961,0.925217,-0.3767,0.0454961,0.925217,-0.3767,0.0454961,0.510647,0.00168934,-0.859789,0.510647,0.00168934,-0.859789,0.510647,0.00168934,-0.859789,-0.470843,-0.19646,-0.860064,-0.470843,-0.19646,-0.860064,-0.470843,-0.19646,-0.860064,-0.916169,-0.380742,0.125179,-0.916169,-0.380742,0.125179,-0.916169,-0.380742,0.125179,-0.429544,-0.635483,0.641602,-0.429544,-0.635483,0.641602,-0.429544,-0.635483,0.641602,0.54759,-0.774938,0.315621,0.54759,-0.774938,0.315621,0.54759,-0.774938,0.315621,0.856118,-0.514651,0.0468571,0.856118,-0.514651,0.0468571,0.856118,-0.514651,0.0468571,0.529633,-0.812576,-0.243328,0.529633,-0.812576,-0.243328,0.529633,-0.812576,-0.243328,0.278483,-0.409708,-0.868669,0.278483,-0.409708,-0.868669,0.278483,-0.409708,-0.868669,-0.381934,-0.908386,-0.170179,-0.381934,-0.908386,-0.170179,-0.381934,-0.908386,-0.170179,-0.316074,-0.434471,-0.843405,-0.316074,-0.434471,-0.843405,-0.316074,-0.434471,-0.843405};
+const GLfloat rock8_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock8_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock8_lod1_numind = 120;
+const GLsizeiptr rock8_lod1_numvert = 120;
+const GLfloat rock8_lod2_vertices[] = {-0.20198,-0.80417,-0.492944,0.404342,-0.819908,0.401951,-0.669012,-0.731472,0.167176,-0.20198,-0.80417,-0.492944,-0.669012,-0.731472,0.167176,-1.0421,0,-0.338593,-0.20198,-0.80417,-0.492944,-1.0421,0,-0.338593,0.0708505,0.144339,-0.892316,0.75883,-0.579701,-0.551321,0.757275,0.468027,-0.550186,0.753512,0.310993,0.356176,0.0708505,0.144339,-0.892316,-1.0421,0,-0.338593,-0.186278,0.975399,-0.573317,0.757275,0.468027,-0.550186,0.0708505,0.144339,-0.892316,-0.186278,0.975399,-0.573317,-1.0421,0,-0.338593,-0.654765,0,0.90121,-0.186278,0.975399,-0.573317,-0.186278,0.975399,-0.573317,-0.654765,0,0.90121,0.0417165,0.687492,0.642219,0.0417165,0.687492,0.642219,0.753512,0.310993,0.356176,-0.186278,0.975399,-0.573317,0.753512,0.310993,0.356176,0.757275,0.468027,-0.550186,-0.186278,0.975399,-0.573317,0.297532,0,0.914403,0.0417165,0.687492,0.642219,-0.654765,0,0.90121,0.297532,0,0.914403,0.753512,0.310993,0.356176,0.0417165,0.687492,0.642219,-0.654765,0,0.90121,0.404342,-0.819908,0.401951,0.297532,0,0.914403,0.297532,0,0.914403,0.404342,-0.819908,0.401951,0.753512,0.310993,0.356176,0.404342,-0.819908,0.401951,0.75883,-0.579701,-0.551321,0.753512,0.310993,0.356176,0.757275,0.468027,-0.550186,0.75883,-0.579701,-0.551321,0.0708505,0.144339,-0.892316,-1.0421,0,-0.338593,-0.669012,-0.731472,0.167176,-0.654765,0,0.90121,-0.669012,-0.731472,0.167176,0.404342,-0.819908,0.401951,-0.654765,0,0.90121,0.404342,-0.819908,0.401951,-0.20198,-0.80417,-0.492944,0.75883,-0.579701,-0.551321,-0.20198,-0.80417,-0.492944,0.0708505,0.144339,-0.892316,0.75883,-0.579701,-0.551321};
+const GLfloat rock8_lod2_normals[] = {-0.0917294,-0.994782,0.0446543,-0.0917294,-0.994782,0.0446543,-0.0917294,-0.994782,0.0446543,-0.669875,-0.622006,-0.405434,-0.669875,-0.622006,-0.405434,-0.669875,-0.622006,-0.405434,-0.404293,-0.253704,-0.878739,-0.404293,-0.253704,-0.878739,-0.404293,-0.253704,-0.878739,0.999989,0.0014794,0.00440799,0.999989,0.0014794,0.00440799,0.999989,0.0014794,0.00440799,-0.457,0.191976,-0.868502,-0.457,0.191976,-0.868502,-0.457,0.191976,-0.868502,0.24321,0.412266,-0.878001,0.24321,0.412266,-0.878001,0.24321,0.412266,-0.878001,-0.706218,0.672737,0.220635,-0.706218,0.672737,0.220635,-0.706218,0.672737,0.220635,-0.615898,0.732863,0.289105,-0.615898,0.732863,0.289105,-0.615898,0.732863,0.289105,0.498916,0.859637,0.11003,0.498916,0.859637,0.11003,0.498916,0.859637,0.11003,0.465109,0.871932,0.153,0.465109,0.871932,0.153,0.465109,0.871932,0.153,-0.0129027,0.363924,0.931339,-0.0129027,0.363924,0.931339,-0.0129027,0.363924,0.931339,0.532801,0.475419,0.700071,0.532801,0.475419,0.700071,0.532801,0.475419,0.700071,-0.0117377,-0.531068,0.847248,-0.0117377,-0.531068,0.847248,-0.0117377,-0.531068,0.847248,0.812509,-0.229168,0.536014,0.812509,-0.229168,0.536014,0.812509,-0.229168,0.536014,0.922016,-0.273588,0.273926,0.922016,-0.273588,0.273926,0.922016,-0.273588,0.273926,0.445468,0.00163107,-0.895296,0.445468,0.00163107,-0.895296,0.445468,0.00163107,-0.895296,-0.918994,-0.270217,0.28711,-0.918994,-0.270217,0.28711,-0.918994,-0.270217,0.28711,-0.208364,-0.690769,0.692403,-0.208364,-0.690769,0.692403,-0.208364,-0.690769,0.692403,0.215086,-0.962953,-0.162664,0.215086,-0.962953,-0.162664,0.215086,-0.962953,-0.162664,0.0369793,-0.396808,-0.917156,0.0369793,-0.396808,-0.917156,0.0369793,-0.396808,-0.917156};
+const GLfloat rock8_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock8_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock8_lod2_numind = 60;
+const GLsizeiptr rock8_lod2_numvert = 60;
+
+#endif
@@ -0,0 +1,18 @@
+
+#ifndef rock9_lod_H
+#define rock9_lod_H
+
+const GLfloat rock9_lod1_vertices[] = {-0.880871,-0.54441,-0.639982,0.169248,-0.886224,0.520902,-0.741084,-0.458023,0.247487,-0.880871,-0.54441,-0.639982,-0.741084,-0.458023,0.247487,-0.605182,0,-0.450833,-0.741084,-0.458023,0.247487,0.319636,-0.517201,0.983759,-0.777576,0,0.598536,-0.322333,-0.644667,-0.992024,0,0,-1.0883,0.690418,0,-0.950284,0.95931,-0.479656,0,0.690418,0,-0.950284,1.11825,0,0.363334,0.319636,-0.517201,0.983759,0.738111,-0.563873,0.536268,0,0,1.21223,0.548499,0.509102,0.687904,1.00019,0.618155,0,0.38567,0.771346,0.280202,-0.656776,1.0627,0,-0.268997,0.802415,0.827904,0,1.24927,0,-0.656776,1.0627,0,-0.777576,0,0.598536,-0.268997,0.802415,0.827904,-0.268997,0.802415,0.827904,0.38567,0.771346,0.280202,0,1.24927,0,-0.268997,0.802415,0.827904,0.548499,0.509102,0.687904,0.38567,0.771346,0.280202,0.38567,0.771346,0.280202,0.266177,0.532354,-0.439651,0,1.24927,0,0.38567,0.771346,0.280202,1.00019,0.618155,0,0.266177,0.532354,-0.439651,0.266177,0.532354,-0.439651,-0.236309,0.693215,-0.7273,0,1.24927,0,-0.236309,0.693215,-0.7273,-0.656776,1.0627,0,0,1.24927,0,-0.236309,0.693215,-0.7273,-0.605182,0,-0.450833,-0.656776,1.0627,0,0,0,1.21223,0.548499,0.509102,0.687904,-0.268997,0.802415,0.827904,0,0,1.21223,0.738111,-0.563873,0.536268,0.548499,0.509102,0.687904,1.11825,0,0.363334,1.00019,0.618155,0,0.548499,0.509102,0.687904,1.11825,0,0.363334,0.690418,0,-0.950284,1.00019,0.618155,0,0.690418,0,-0.950284,0.266177,0.532354,-0.439651,1.00019,0.618155,0,0.690418,0,-0.950284,0,0,-1.0883,0.266177,0.532354,-0.439651,0,0,-1.0883,-0.236309,0.693215,-0.7273,0.266177,0.532354,-0.439651,-0.777576,0,0.598536,0,0,1.21223,-0.268997,0.802415,0.827904,-0.777576,0,0.598536,0.319636,-0.517201,0.983759,0,0,1.21223,0.738111,-0.563873,0.536268,1.11825,0,0.363334,0.548499,0.509102,0.687904,0.738111,-0.563873,0.536268,0.95931,-0.479656,0,1.11825,0,0.363334,0.95931,-0.479656,0,-0.322333,-0.644667,-0.992024,0.690418,0,-0.950284,0,0,-1.0883,-0.605182,0,-0.450833,-0.236309,0.693215,-0.7273,0,0,-1.0883,-0.322333,-0.644667,-0.992024,-0.605182,0,-0.450833,-0.322333,-0.644667,-0.992024,-0.880871,-0.54441,-0.639982,-0.605182,0,-0.450833,-0.605182,0,-0.450833,-0.777576,0,0.598536,-0.656776,1.0627,0,-0.605182,0,-0.450833,-0.741084,-0.458023,0.247487,-0.777576,0,0.598536,0.169248,-0.886224,0.520902,0.319636,-0.517201,0.983759,-0.741084,-0.458023,0.247487,0.169248,-0.886224,0.520902,0.738111,-0.563873,0.536268,0.319636,-0.517201,0.983759,0.169248,-0.886224,0.520902,0.547712,-0.886221,0,0.738111,-0.563873,0.536268,0.547712,-0.886221,0,0.95931,-0.479656,0,0.738111,-0.563873,0.536268,0.547712,-0.886221,0,-0.322333,-0.644667,-0.992024,0.95931,-0.479656,0,0.547712,-0.886221,0,0.169248,-0.886224,0.520902,-0.322333,-0.644667,-0.992024,0.169248,-0.886224,0.520902,-0.880871,-0.54441,-0.639982,-0.322333,-0.644667,-0.992024};
+const GLfloat rock9_lod1_normals[] = {-0.458648,-0.874572,0.157375,-0.458648,-0.874572,0.157375,-0.458648,-0.874572,0.157375,-0.901271,0.42133,0.100948,-0.901271,0.42133,0.100948,-0.901271,0.42133,0.100948,-0.49575,-0.552843,0.669773,-0.49575,-0.552843,0.669773,-0.49575,-0.552843,0.669773,0.190422,-0.237472,-0.952547,0.190422,-0.237472,-0.952547,0.190422,-0.237472,-0.952547,0.947776,-0.080235,-0.308681,0.947776,-0.080235,-0.308681,0.947776,-0.080235,-0.308681,0.729468,0.156698,0.665825,0.729468,0.156698,0.665825,0.729468,0.156698,0.665825,0.38488,0.838535,0.385651,0.38488,0.838535,0.385651,0.38488,0.838535,0.385651,-0.251007,0.883569,0.395349,-0.251007,0.883569,0.395349,-0.251007,0.883569,0.395349,-0.79413,0.36427,0.486482,-0.79413,0.36427,0.486482,-0.79413,0.36427,0.486482,0.478528,0.698276,0.532373,0.478528,0.698276,0.532373,0.478528,0.698276,0.532373,0.369433,0.841672,0.393838,0.369433,0.841672,0.393838,0.369433,0.841672,0.393838,0.820671,0.487493,-0.298076,0.820671,0.487493,-0.298076,0.820671,0.487493,-0.298076,0.0856664,0.941234,-0.32671,0.0856664,0.941234,-0.32671,0.0856664,0.941234,-0.32671,0.537018,0.576848,-0.615515,0.537018,0.576848,-0.615515,0.537018,0.576848,-0.615515,-0.229471,0.80776,-0.543016,-0.229471,0.80776,-0.543016,-0.229471,0.80776,-0.543016,-0.800483,0.200721,-0.564745,-0.800483,0.200721,-0.564745,-0.800483,0.200721,-0.564745,0.315941,0.49391,0.810082,0.315941,0.49391,0.810082,0.315941,0.49391,0.810082,0.682442,0.0173282,0.730735,0.682442,0.0173282,0.730735,0.682442,0.0173282,0.730735,0.710932,0.452303,0.538513,0.710932,0.452303,0.538513,0.710932,0.452303,0.538513,0.950841,-0.000420128,-0.309679,0.950841,-0.000420128,-0.309679,0.950841,-0.000420128,-0.309679,0.260394,0.768337,-0.584682,0.260394,0.768337,-0.584682,0.260394,0.768337,-0.584682,0.132073,0.738965,-0.660671,0.132073,0.738965,-0.660671,0.132073,0.738965,-0.660671,0.543071,0.525986,-0.654532,0.543071,0.525986,-0.654532,0.543071,0.525986,-0.654532,-0.610939,0.16595,0.774089,-0.610939,0.16595,0.774089,-0.610939,0.16595,0.774089,-0.500474,-0.589416,0.634125,-0.500474,-0.589416,0.634125,-0.500474,-0.589416,0.634125,0.465473,-0.0426781,0.884033,0.465473,-0.0426781,0.884033,0.465473,-0.0426781,0.884033,0.83484,-0.480338,0.26892,0.83484,-0.480338,0.26892,0.83484,-0.480338,0.26892,0.479683,-0.721209,-0.499761,0.479683,-0.721209,-0.499761,0.479683,-0.721209,-0.499761,-0.720783,0.110641,-0.684274,-0.720783,0.110641,-0.684274,-0.720783,0.110641,-0.684274,-0.701935,0.251444,-0.666381,-0.701935,0.251444,-0.666381,-0.701935,0.251444,-0.666381,-0.405975,0.476523,-0.779814,-0.405975,0.476523,-0.779814,-0.405975,0.476523,-0.779814,-0.986558,0.0208605,-0.162075,-0.986558,0.0208605,-0.162075,-0.986558,0.0208605,-0.162075,-0.985747,0.0455825,-0.161942,-0.985747,0.0455825,-0.161942,-0.985747,0.0455825,-0.161942,-0.476313,-0.605535,0.637536,-0.476313,-0.605535,0.637536,-0.476313,-0.605535,0.637536,0.423653,-0.77035,0.476528,0.423653,-0.77035,0.476528,0.423653,-0.77035,0.476528,0.458081,-0.824254,0.332816,0.458081,-0.824254,0.332816,0.458081,-0.824254,0.332816,0.691852,-0.700416,0.175379,0.691852,-0.700416,0.175379,0.691852,-0.700416,0.175379,0.551546,-0.558374,-0.61969,0.551546,-0.558374,-0.61969,0.551546,-0.558374,-0.61969,-0.149234,-0.982838,-0.108433,-0.149234,-0.982838,-0.108433,-0.149234,-0.982838,-0.108433,-0.225717,-0.970765,-0.0816541,-0.225717,-0.970765,-0.0816541,-0.225717,-0.970765,-0.0816541};
+const GLfloat rock9_lod1_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock9_lod1_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119};
+const GLsizeiptr rock9_lod1_numind = 120;
+const GLsizeiptr rock9_lod1_numvert = 120;
+const GLfloat rock9_lod2_vertices[] = {-0.810977,-0.501216,-0.196248,0.159818,-0.258601,1.09799,-0.777576,0,0.598536,0.547712,-0.886221,0,0.845303,0.309078,-0.475142,0.928181,-0.281936,0.449801,-0.268997,0.802415,0.827904,0.845303,0.309078,-0.475142,0.192835,1.01031,0.140101,-0.656776,1.0627,0,-0.268997,0.802415,0.827904,0.192835,1.01031,0.140101,-0.656776,1.0627,0,-0.777576,0,0.598536,-0.268997,0.802415,0.827904,0.192835,1.01031,0.140101,0.845303,0.309078,-0.475142,-0.236309,0.693215,-0.7273,-0.236309,0.693215,-0.7273,-0.656776,1.0627,0,0.192835,1.01031,0.140101,-0.236309,0.693215,-0.7273,-0.810977,-0.501216,-0.196248,-0.656776,1.0627,0,0.159818,-0.258601,1.09799,0.928181,-0.281936,0.449801,-0.268997,0.802415,0.827904,0.928181,-0.281936,0.449801,0.845303,0.309078,-0.475142,-0.268997,0.802415,0.827904,0.845303,0.309078,-0.475142,-0.161167,-0.322334,-1.04016,-0.236309,0.693215,-0.7273,-0.777576,0,0.598536,0.159818,-0.258601,1.09799,-0.268997,0.802415,0.827904,0.547712,-0.886221,0,-0.161167,-0.322334,-1.04016,0.845303,0.309078,-0.475142,-0.161167,-0.322334,-1.04016,-0.810977,-0.501216,-0.196248,-0.236309,0.693215,-0.7273,-0.810977,-0.501216,-0.196248,-0.777576,0,0.598536,-0.656776,1.0627,0,0.169248,-0.886224,0.520902,0.159818,-0.258601,1.09799,-0.810977,-0.501216,-0.196248,0.169248,-0.886224,0.520902,0.928181,-0.281936,0.449801,0.159818,-0.258601,1.09799,0.169248,-0.886224,0.520902,0.547712,-0.886221,0,0.928181,-0.281936,0.449801,0.547712,-0.886221,0,0.169248,-0.886224,0.520902,-0.161167,-0.322334,-1.04016,0.169248,-0.886224,0.520902,-0.810977,-0.501216,-0.196248,-0.161167,-0.322334,-1.04016};
+const GLfloat rock9_lod2_normals[] = {-0.463524,-0.740576,0.486511,-0.463524,-0.740576,0.486511,-0.463524,-0.740576,0.486511,0.892055,-0.340303,-0.297374,0.892055,-0.340303,-0.297374,0.892055,-0.340303,-0.297374,0.780915,0.210684,0.588034,0.780915,0.210684,0.588034,0.780915,0.210684,0.588034,0.0101614,0.955269,0.295563,0.0101614,0.955269,0.295563,0.0101614,0.955269,0.295563,-0.79413,0.36427,0.486482,-0.79413,0.36427,0.486482,-0.79413,0.36427,0.486482,0.390844,0.785151,-0.480395,0.390844,0.785151,-0.480395,0.390844,0.785151,-0.480395,0.121022,0.9115,-0.393091,0.121022,0.9115,-0.393091,0.121022,0.9115,-0.393091,-0.820987,0.150075,-0.55087,-0.820987,0.150075,-0.55087,-0.820987,0.150075,-0.55087,0.593874,0.415412,0.689019,0.593874,0.415412,0.689019,0.593874,0.415412,0.689019,0.687509,0.638307,0.346259,0.687509,0.638307,0.346259,0.687509,0.638307,0.346259,0.316506,0.300595,-0.899704,0.316506,0.300595,-0.899704,0.316506,0.300595,-0.899704,-0.461444,0.0391213,0.886306,-0.461444,0.0391213,0.886306,-0.461444,0.0391213,0.886306,0.629653,-0.417256,-0.655313,0.629653,-0.417256,-0.655313,0.629653,-0.417256,-0.655313,-0.798747,0.122382,-0.58909,-0.798747,0.122382,-0.58909,-0.798747,0.122382,-0.58909,-0.994668,0.100806,-0.0217696,-0.994668,0.100806,-0.0217696,-0.994668,0.100806,-0.0217696,-0.625906,-0.532951,0.569391,-0.625906,-0.532951,0.569391,-0.625906,-0.532951,0.569391,0.517254,-0.575047,0.633852,0.517254,-0.575047,0.633852,0.517254,-0.575047,0.633852,0.587446,-0.687562,0.426808,0.587446,-0.687562,0.426808,0.587446,-0.687562,0.426808,-0.347644,-0.902964,-0.252588,-0.347644,-0.902964,-0.252588,-0.347644,-0.902964,-0.252588,-0.142943,-0.940145,-0.309345,-0.142943,-0.940145,-0.309345,-0.142943,-0.940145,-0.309345};
+const GLfloat rock9_lod2_colors[] = {0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412,0.396,0.412,0.412};
+const GLushort rock9_lod2_indices[] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59};
+const GLsizeiptr rock9_lod2_numind = 60;
+const GLsizeiptr rock9_lod2_numvert = 60;
+
+#endif
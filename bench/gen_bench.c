@@ -0,0 +1,154 @@
+/*
+    World generation time of newGame(), the old single rand() stream against
+    the counter based generator in sim.h on 1..N pool threads.
+
+    Every run also hashes the rocks and colour arrays it made, the counter
+    based runs must all print the same hash whatever the thread count.
+
+    Compile: gcc bench/gen_bench.c -Ofast -lm -lpthread -o bench/gen_bench
+    Usage:   ./bench/gen_bench [max threads] [runs]
+*/
+#include "../sim.h"
+
+world w;
+f32* colors;
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t fnv(uint64_t h, const void* data, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for(size_t i = 0; i < len; i++)
+        h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+static uint64_t genHash()
+{
+    uint64_t h = fnv(14695981039346656037ULL, &w.rocks.pos[0], ARRAY_MAX*sizeof(vec));
+    h = fnv(h, &w.rocks.vel[0], ARRAY_MAX*sizeof(vec));
+    return fnv(h, &colors[0], ARRAY_MAX*720*sizeof(f32));
+}
+
+//*************************************
+// before, one rand() stream in rock order
+//*************************************
+static inline f32 legacyRandFloat(const f32 min, const f32 max)
+{
+    static f32 rndmax = 1.f/(f32)RAND_MAX;
+    return ((((f32)rand()) * rndmax) * (max-min)) + min;
+}
+
+void legacyNew(unsigned int seed)
+{
+    srand(seed);
+    const f32 far = (float)ARRAY_MAX / legacyRandFloat(8.f, 12.f);
+
+    gi* r = &w.rocks;
+    gridReset(&w);
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+    {
+        r->free[i] = 0;
+        r->scale[i] = legacyRandFloat(0.1f, MAX_ROCK_SCALE);
+        r->pos[i].x = legacyRandFloat(-far, far);
+        r->pos[i].y = legacyRandFloat(-far, far);
+        r->pos[i].z = legacyRandFloat(-far, far);
+        r->lpos[i] = r->pos[i];
+        gridInsert(&w, i);
+
+        r->rnd[i] = (uint)legacyRandFloat(0.f, 1000.f);
+        r->rndf[i] = legacyRandFloat(0.05f, 0.3f);
+
+        const f32 q[5] = {legacyRandFloat(0.f, 1.f), legacyRandFloat(0.f, 1.f), legacyRandFloat(0.f, 1.f), legacyRandFloat(0.f, 1.f), legacyRandFloat(0.f, 1.f)};
+        const int ores = legacyRandFloat(0.f, 1000.f) < 500.f;
+        r->qbreak[i] = ores ? q[0] : 0.f;
+        r->qshield[i] = ores ? q[1] : 0.f;
+        r->qslow[i] = ores ? q[2] : 0.f;
+        r->qrepel[i] = ores ? q[3] : 0.f;
+        r->qfuel[i] = ores ? q[4] : 0.f;
+        r->nores[i] = !ores;
+
+        // same draws and tints as the old colour loop
+        const f32 chance[5] = {r->qbreak[i], r->qshield[i], r->qslow[i], r->qrepel[i], r->qfuel[i]};
+        const f32 tint[6][3] = {{0.644f, 0.209f, 0.f}, {0.f, 0.8f, 0.28f}, {0.429f, 0.f, 0.8f}, {0.095f, 0.069f, 0.041f}, {0.062f, 1.f, 0.873f}, {ROCK_DARKNESS, ROCK_DARKNESS, ROCK_DARKNESS}};
+        f32* c = &colors[i*720];
+        for(unsigned int j = 0; j < 720; j += 3)
+        {
+            unsigned int k = 0;
+            while(k < 5 && legacyRandFloat(0.f, 1.f) >= chance[k]*CLR_CHANCE)
+                k++;
+            c[j] = tint[k][0];
+            c[j+1] = tint[k][1];
+            c[j+2] = tint[k][2];
+        }
+
+        vRuv(&r->vel[i]);
+    }
+}
+
+//*************************************
+// benchmark
+//*************************************
+int main(int argc, char** argv)
+{
+    unsigned int max_threads = 0;
+    unsigned int runs = 5;
+    if(argc > 1){max_threads = atoi(argv[1]);}
+    if(argc > 2){runs = atoi(argv[2]);}
+    colors = malloc(ARRAY_MAX*720*sizeof(f32));
+    if(sim_init(&w) == 0 || colors == NULL)
+    {
+        printf("Out of memory for %u rocks.\n", ARRAY_MAX);
+        return 1;
+    }
+    if(max_threads == 0)
+    {
+        poolInit(0);
+        max_threads = poolThreads();
+        poolQuit();
+    }
+
+    double best = 1e9;
+    for(unsigned int k = 0; k < runs; k++)
+    {
+        const double st = now();
+        legacyNew(NEWGAME_SEED);
+        const double t = now() - st;
+        if(t < best){best = t;}
+    }
+    const double legacy = best;
+
+    printf("rocks: %u, runs: %u (best of)\n", ARRAY_MAX, runs);
+    printf("generator         threads       ms   speedup  hash\n");
+    printf("rand() stream     %7u %8.2f %8.2fx  %016llx\n", 1, legacy*1e3, 1.0, (unsigned long long)genHash());
+
+    uint64_t first = 0;
+    int same = 1;
+    for(unsigned int threads = 1; threads <= max_threads;)
+    {
+        poolInit(threads);
+        best = 1e9;
+        for(unsigned int k = 0; k < runs; k++)
+        {
+            const double st = now();
+            sim_new(&w, NEWGAME_SEED);
+            sim_colors(&w, 0, ARRAY_MAX, &colors[0]);
+            const double t = now() - st;
+            if(t < best){best = t;}
+        }
+        const uint64_t h = genHash();
+        if(threads == 1){first = h;}
+        if(h != first){same = 0;}
+        printf("counter (squares) %7u %8.2f %8.2fx  %016llx\n", poolThreads(), best*1e3, legacy/best, (unsigned long long)h);
+        poolQuit();
+        if(threads == max_threads){break;}
+        threads = threads*2 < max_threads ? threads*2 : max_threads; // always finish on max_threads
+    }
+    printf(same ? "counter based worlds match for every thread count\n" : "warning: counter based worlds differ between thread counts\n");
+    return same ? 0 : 1;
+}
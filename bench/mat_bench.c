@@ -0,0 +1,102 @@
+/*
+    Microbenchmark for mModelViewN() in mat.h against the per-call
+    mIdent/mTranslate/mRotY/mRotZ/mRotX/mScale/mMul chain it replaces.
+
+    The batch runs the kernel mat.h binds for this CPU, AVX2 8 wide only
+    when the whole build is for AVX2.
+
+    Compile: gcc bench/mat_bench.c -Ofast -lm -o bench/mat_bench
+    AVX2:    gcc bench/mat_bench.c -Ofast -mavx2 -mfma -lm -o bench/mat_bench
+    Usage:   ./bench/mat_bench [count] [frames]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../mat.h"
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int n = 16384, frames = 600;
+    if(argc > 1){n = atoi(argv[1]);}
+    if(argc > 2){frames = atoi(argv[2]);}
+
+    float *x = malloc(n*sizeof(float)), *y = malloc(n*sizeof(float)), *z = malloc(n*sizeof(float)), *s = malloc(n*sizeof(float));
+    float *rx = malloc(n*sizeof(float)), *ry = malloc(n*sizeof(float)), *rz = malloc(n*sizeof(float));
+    mat *ra = malloc(n*sizeof(mat)), *rb = malloc(n*sizeof(mat));
+    if(x == NULL || y == NULL || z == NULL || s == NULL || rx == NULL || ry == NULL || rz == NULL || ra == NULL || rb == NULL)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    // same ranges the game feeds in: positions inside the sphere, scale 0.1-3.3, angles growing with time
+    srandf(1337);
+    for(unsigned int i = 0; i < n; i++)
+    {
+        x[i] = randfc()*200.f;
+        y[i] = randfc()*200.f;
+        z[i] = randfc()*200.f;
+        s[i] = 0.1f + randf()*3.2f;
+        rx[i] = randfc()*600.f;
+        ry[i] = randfc()*600.f;
+        rz[i] = randfc()*600.f;
+    }
+
+    mat view;
+    mIdent(&view);
+    mTranslate(&view, 3.f, -7.f, 11.f);
+    mRotate(&view, 0.7f, 0.3f, 0.9f, 0.1f);
+
+    // per-call reference
+    double t = now();
+    for(unsigned int f = 0; f < frames; f++)
+    {
+        view.m[3][0] = (float)f * 0.001f;
+        for(unsigned int i = 0; i < n; i++)
+            mModelView(&ra[i], &view, x[i], y[i], z[i], s[i], rx[i], ry[i], rz[i]);
+    }
+    const double ta = now() - t;
+
+    // batch
+    t = now();
+    for(unsigned int f = 0; f < frames; f++)
+    {
+        view.m[3][0] = (float)f * 0.001f;
+        mModelViewN(rb, &view, x, y, z, s, rx, ry, rz, n);
+    }
+    const double tb = now() - t;
+
+    // agreement, relative to the magnitude of each element
+    float maxerr = 0.f;
+    for(unsigned int i = 0; i < n; i++)
+    {
+        for(int c = 0; c < 4; c++)
+        {
+            for(int r = 0; r < 4; r++)
+            {
+                const float a = ra[i].m[c][r], b = rb[i].m[c][r];
+                const float e = fabsf(a - b) / (1.f + fabsf(a));
+                if(e > maxerr){maxerr = e;}
+            }
+        }
+    }
+
+    const double mats = (double)n * (double)frames;
+    printf("cpu:       %s\n", cpuName());
+    printf("kernel:    %s\n", mKernel());
+    printf("matrices:  %u x %u frames\n", n, frames);
+    printf("per-call:  %.2f ns/matrix, %.3f ms/frame\n", ta*1e9/mats, ta*1e3/frames);
+    printf("batch:     %.2f ns/matrix, %.3f ms/frame\n", tb*1e9/mats, tb*1e3/frames);
+    printf("speedup:   %.2fx\n", ta/tb);
+    printf("max error: %g\n", maxerr);
+
+    free(x), free(y), free(z), free(s), free(rx), free(ry), free(rz), free(ra), free(rb);
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+    Per-frame memory traffic of the rock integration loop in main_loop(),
+    the old 4 KB array-of-structs layout against the hot/cold struct of arrays.
+
+    Traffic is counted by replaying the loop's loads & stores and marking every
+    distinct 64 byte cache line and 4 KB page they land on, then both loops are
+    timed over the same frames.
+
+    Compile: gcc bench/rock_bench.c -Ofast -lm -o bench/rock_bench
+    Usage:   ./bench/rock_bench [frames]
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "../vec.h"
+
+typedef float f32;
+typedef unsigned int uint;
+
+#define ARRAY_MAX 16384
+
+// before
+typedef struct
+{
+    int free;
+    int nores;
+    f32 scale;
+    vec pos;
+    vec vel;
+    uint rnd;
+    f32 rndf;
+    f32 colors[720];
+    f32 qshield;
+    f32 qbreak;
+    f32 qslow;
+    f32 qrepel;
+    f32 qfuel;
+} gi_aos;
+gi_aos aos[ARRAY_MAX];
+
+// after, same as main.c
+typedef struct
+{
+    int free[ARRAY_MAX];
+    f32 scale[ARRAY_MAX];
+    vec pos[ARRAY_MAX];
+    vec vel[ARRAY_MAX];
+
+    int nores[ARRAY_MAX];
+    uint rnd[ARRAY_MAX];
+    f32 rndf[ARRAY_MAX];
+
+    f32 qshield[ARRAY_MAX];
+    f32 qbreak[ARRAY_MAX];
+    f32 qslow[ARRAY_MAX];
+    f32 qrepel[ARRAY_MAX];
+    f32 qfuel[ARRAY_MAX];
+} gi_soa;
+gi_soa soa;
+
+//*************************************
+// traffic counter
+//*************************************
+typedef struct
+{
+    uintptr_t base;
+    unsigned char* line;
+    unsigned char* page;
+    size_t lines, pages;
+} tc;
+
+void tcInit(tc* c, const void* base, const size_t size)
+{
+    c->base = (uintptr_t)base & ~(uintptr_t)63;
+    c->line = calloc(size/64 + 2, 1);
+    c->page = calloc(size/4096 + 2, 1);
+    c->lines = 0, c->pages = 0;
+}
+
+static inline void tcTouch(tc* c, const void* p, const size_t n)
+{
+    for(uintptr_t a = (uintptr_t)p; a < (uintptr_t)p + n; a = (a & ~(uintptr_t)63) + 64)
+    {
+        const size_t l = (a - c->base) / 64;
+        const size_t g = (a - (c->base & ~(uintptr_t)4095)) / 4096;
+        if(c->line[l] == 0){c->line[l] = 1; c->lines++;}
+        if(c->page[g] == 0){c->page[g] = 1; c->pages++;}
+    }
+}
+
+//*************************************
+// the integration loop, as in main_loop()
+//*************************************
+vec pp = {0};
+f32 so;
+
+void stepAoS(const f32 dt, tc* c)
+{
+    so = 0.f;
+    for(uint i = 0; i < ARRAY_MAX; i++)
+    {
+        if(c != NULL){tcTouch(c, &aos[i].free, sizeof(int));}
+        if(aos[i].free != 1)
+        {
+            if(c != NULL)
+            {
+                tcTouch(c, &aos[i].vel, sizeof(vec));
+                tcTouch(c, &aos[i].pos, sizeof(vec));
+                tcTouch(c, &aos[i].scale, sizeof(f32));
+            }
+            vec inc;
+            vMulS(&inc, aos[i].vel, dt);
+            vAdd(&aos[i].pos, aos[i].pos, inc);
+            const f32 dist = vDist(pp, aos[i].pos);
+            if(dist < 10.f + aos[i].scale)
+                if(so == 0.f || dist < so){so = dist;}
+        }
+    }
+}
+
+void stepSoA(const f32 dt, tc* c)
+{
+    so = 0.f;
+    for(uint i = 0; i < ARRAY_MAX; i++)
+    {
+        if(c != NULL){tcTouch(c, &soa.free[i], sizeof(int));}
+        if(soa.free[i] != 1)
+        {
+            if(c != NULL)
+            {
+                tcTouch(c, &soa.vel[i], sizeof(vec));
+                tcTouch(c, &soa.pos[i], sizeof(vec));
+                tcTouch(c, &soa.scale[i], sizeof(f32));
+            }
+            vec inc;
+            vMulS(&inc, soa.vel[i], dt);
+            vAdd(&soa.pos[i], soa.pos[i], inc);
+            const f32 dist = vDist(pp, soa.pos[i]);
+            if(dist < 10.f + soa.scale[i])
+                if(so == 0.f || dist < so){so = dist;}
+        }
+    }
+}
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv)
+{
+    uint frames = 3600;
+    if(argc > 1){frames = atoi(argv[1]);}
+
+    // same distribution as newGame(), a few rocks already mined out
+    srandf(1337);
+    for(uint i = 0; i < ARRAY_MAX; i++)
+    {
+        const vec p = (vec){randfc()*2048.f, randfc()*2048.f, randfc()*2048.f, 0.f};
+        vec v;
+        vRuv(&v);
+        const f32 s = 0.1f + randf()*11.9f;
+        const int f = randf() < 0.01f;
+        aos[i].free = f, aos[i].scale = s, aos[i].pos = p, aos[i].vel = v;
+        soa.free[i] = f, soa.scale[i] = s, soa.pos[i] = p, soa.vel[i] = v;
+    }
+
+    tc ca, cs;
+    tcInit(&ca, aos, sizeof(aos));
+    tcInit(&cs, &soa, sizeof(soa));
+    stepAoS(0.f, &ca);
+    stepSoA(0.f, &cs);
+
+    const f32 dt = 1.f/60.f;
+    double t = now();
+    for(uint f = 0; f < frames; f++){stepAoS(dt, NULL);}
+    const double ta = (now() - t) / frames;
+    const f32 aos_so = so;
+    t = now();
+    for(uint f = 0; f < frames; f++){stepSoA(dt, NULL);}
+    const double ts = (now() - t) / frames;
+
+    printf("rocks: %u, frames: %u\n", ARRAY_MAX, frames);
+    printf("          lines/frame  bytes/frame  pages/frame  us/frame\n");
+    printf("AoS  %14zu %12zu %12zu %9.2f\n", ca.lines, ca.lines*64, ca.pages, ta*1e6);
+    printf("SoA  %14zu %12zu %12zu %9.2f\n", cs.lines, cs.lines*64, cs.pages, ts*1e6);
+    printf("traffic: %.2fx less, pages: %.0fx less, time: %.2fx faster\n", (double)ca.lines/cs.lines, (double)ca.pages/cs.pages, ta/ts);
+    if(aos_so != so){printf("warning: results differ (%g vs %g)\n", aos_so, so);}
+    return 0;
+}
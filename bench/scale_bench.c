@@ -0,0 +1,208 @@
+/*
+    Frame work against thread count, the way the game runs it: the sim
+    thread steps the headless.c flight with sim_step() and publishes
+    snapshots with snapPublish() on its pool, while the render thread
+    takes them and stages every rock (interpolated instance & distance,
+    main.c's stageRocks() without the LOD pick) on a pool of its own.
+    The CPUs are split between the two pools as the game splits them.
+
+    For each thread count it prints the sim's step & publish time, the
+    renderer's staging time and how many snapshots it staged while the
+    sim ran flat out, then the same frame on one thread (simthread=0) for
+    comparison. The world hash must be the same for every thread count.
+
+    Compile: gcc bench/scale_bench.c -Ofast -lm -lpthread -o bench/scale_bench
+    Usage:   ./bench/scale_bench [max threads] [steps] [--rocks=n] [--stream] [--config=file]
+*/
+#include "../snapshot.h"
+
+world w;
+input inp;
+pool stage_pool;
+
+f32* stage_data;
+f32* stage_dist;
+
+unsigned int steps = 600;
+unsigned int sim_done = 0;
+double sim_time = 0.0;          // sim thread, step & publish
+double stage_time = 0.0;        // render thread
+unsigned int stage_frames = 0;
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t fnv(uint64_t h, const void* data, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for(size_t i = 0; i < len; i++)
+        h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+static uint64_t worldHash()
+{
+    uint64_t h = fnv(14695981039346656037ULL, &w.rocks.pos[0], ARRAY_MAX*sizeof(vec));
+    const f32 pl[5] = {w.pp.x, w.pp.y, w.pp.z, w.pf, (f32)w.pm};
+    return fnv(h, &pl[0], sizeof(pl));
+}
+
+// the headless.c flight
+static void step(unsigned int i)
+{
+    inp.keys[2] = 1;
+    inp.keys[0] = (i % 600) < 30;
+    inp.xrot = w.pr;
+    sim_step(&w, &inp, SIM_DT);
+    if(i % 30 == 0){sim_break(&w);}
+    if(i % 120 == 60){sim_repel(&w);}
+    if(i % 600 == 300){sim_stop(&w);}
+}
+
+typedef struct
+{
+    const snapshot* s;
+    vec pp;
+} stagejob;
+
+static void stageRocks(void* arg, unsigned int start, unsigned int end)
+{
+    const stagejob* j = (const stagejob*)arg;
+    const snapshot* s = j->s;
+    for(unsigned int c = start; c < end; c++)
+    {
+        const unsigned int last = (c+1)*STEP_RUN < s->num ? (c+1)*STEP_RUN : s->num;
+        for(unsigned int k = c*STEP_RUN; k < last; k++)
+        {
+            if((s->flag[k] & SNAP_ASLEEP) != 0)
+                continue;
+            const f32* r = &s->rock[k*SNAP_FLOATS];
+            f32* d = &stage_data[k*8];
+            d[0] = r[0] + (r[3]-r[0]) * 0.5f;
+            d[1] = r[1] + (r[4]-r[1]) * 0.5f;
+            d[2] = r[2] + (r[5]-r[2]) * 0.5f;
+            d[3] = r[6];
+            d[4] = r[7];
+            d[5] = r[8];
+            d[6] = r[9];
+            d[7] = 0.f;
+            stage_dist[k] = vDist(j->pp, (vec){d[0], d[1], d[2], 0.f});
+        }
+    }
+}
+
+static void stage(const snapshot* s)
+{
+    snapevent e;
+    while(snapNext(s, &e) == 1){}
+    stagejob job = {s, s->pp};
+    poolRun(stageRocks, &job, (s->num + STEP_RUN-1) / STEP_RUN);
+}
+
+static void* simMain(void* arg)
+{
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        const double st = now();
+        step(i);
+        snapPublish(&w, 0.0, 0.0, 0);
+        sim_time += now() - st;
+    }
+    __atomic_store_n(&sim_done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int max_threads = 0;
+    unsigned int pos = 0;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strncmp(argv[i], "--config=", 9) == 0)
+        {
+            if(sim_config(&argv[i][9], sim_option) == 0)
+                printf("Could not read config: %s\n", &argv[i][9]);
+        }
+        else if(strncmp(argv[i], "--", 2) == 0)
+        {
+            if(sim_option(&argv[i][2]) == 0)
+                printf("Unknown option: %s\n", argv[i]);
+        }
+        else if(pos == 0){max_threads = atoi(argv[i]); pos++;}
+        else if(pos == 1){steps = atoi(argv[i]); pos++;}
+    }
+    if(max_threads == 0){max_threads = poolCPUs();}
+    stage_data = malloc((size_t)ARRAY_MAX*8*sizeof(f32));
+    stage_dist = malloc(ARRAY_MAX*sizeof(f32));
+    if(sim_init(&w) == 0 || snapInit(ARRAY_MAX, w.sectors) == 0 || stage_data == NULL || stage_dist == NULL)
+    {
+        printf("Out of memory for %u rocks.\n", ARRAY_MAX);
+        return 1;
+    }
+
+    printf("rocks: %u, steps: %u, cpus: %u, %s\n", ARRAY_MAX, steps, poolCPUs(), step_kernel);
+    printf("threads  sim+render  step+publish ms  stage ms  staged  one thread ms  speedup  hash\n");
+    uint64_t first = 0;
+    double one = 0.0;
+    int same = 1;
+    for(unsigned int threads = 1; threads <= max_threads;)
+    {
+        // sim thread on, each pool gets its share of the threads
+        const unsigned int rt = threads/2 > 0 ? threads/2 : 1;
+        poolInit(threads - threads/2);
+        poolStart(&stage_pool, rt);
+        poolUse(&stage_pool);
+        sim_new(&w, NEWGAME_SEED);
+        snapPublish(&w, 0.0, 0.0, 0);
+        sim_time = stage_time = 0.0;
+        stage_frames = 0;
+        sim_done = 0;
+
+        pthread_t sim;
+        pthread_create(&sim, NULL, simMain, NULL);
+        while(__atomic_load_n(&sim_done, __ATOMIC_ACQUIRE) == 0)
+        {
+            const double st = now();
+            stage(snapTake());
+            stage_time += now() - st;
+            stage_frames++;
+        }
+        pthread_join(sim, NULL);
+        stage(snapTake());
+        const uint64_t h = worldHash();
+        const unsigned int st_threads = stage_pool.threads;
+        poolStop(&stage_pool);
+        poolUse(&workers);
+        poolQuit();
+
+        // simthread=0, step, publish & stage one after the other on all of them
+        poolInit(threads);
+        sim_new(&w, NEWGAME_SEED);
+        double ot = 0.0;
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            const double st = now();
+            step(i);
+            snapPublish(&w, 0.0, 0.0, 0);
+            stage(snapTake());
+            ot += now() - st;
+        }
+        poolQuit();
+        if(worldHash() != h){same = 0;}
+
+        if(threads == 1){first = h, one = ot;}
+        if(h != first){same = 0;}
+        printf("%7u  %4u + %-4u  %15.3f  %8.3f  %6u  %13.3f  %6.2fx  %016llx\n", threads, threads - threads/2, st_threads, sim_time*1e3/steps,
+               stage_frames > 0 ? stage_time*1e3/stage_frames : 0.0, stage_frames, ot*1e3/steps, one/ot, (unsigned long long)h);
+        if(threads == max_threads){break;}
+        threads = threads*2 < max_threads ? threads*2 : max_threads; // always finish on max_threads
+    }
+    printf(same ? "worlds match for every thread count\n" : "warning: worlds differ between thread counts\n");
+    snapFree();
+    sim_free(&w);
+    return same ? 0 : 1;
+}
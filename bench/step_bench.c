@@ -0,0 +1,167 @@
+/*
+    The rock step in sim.h, the scalar run against the 4 lane vector runs
+    (GCC vector extensions built for SSE2/NEON, SSE4.1, AVX2 and NEON on
+    32-bit ARM builds for VFP).
+
+    Each kernel moves the seed 1337 world's rocks in runs of STEP_RUN on
+    one thread, with the player sat among them and some rocks shrinking
+    away, then the same world is stepped through sim_step() with it. Then
+    once more after some rocks slept & woke out of slot order, so runs of
+    4 in world.active that start & end 3 slots apart aren't consecutive,
+    e.g. 6 8 9 10 with 7 asleep once the compaction merged them back. Every kernel must print the scalar
+    run's hashes.
+
+    Compile: gcc bench/step_bench.c -Ofast -lm -lpthread -o bench/step_bench
+    Usage:   ./bench/step_bench [rocks] [frames]
+*/
+#include "../sim.h"
+
+world w;
+input inp;
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t fnv(uint64_t h, const void* data, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for(size_t i = 0; i < len; i++)
+        h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+// what sim_step() does with the runs' relink lists
+static void relinkGrid(unsigned int runs)
+{
+    for(unsigned int c = 0; c < runs; c++)
+    {
+        for(unsigned int k = 0; k < w.run_relink[c]; k++)
+        {
+            const unsigned int i = w.relink[c*STEP_RUN + k];
+            gridRemove(&w, i);
+            if(w.rocks.free[i] != 1)
+                gridInsert(&w, i);
+        }
+    }
+}
+
+// rock positions & scales
+static uint64_t rockHash()
+{
+    uint64_t h = fnv(14695981039346656037ULL, &w.rocks.pos[0], ARRAY_MAX*sizeof(vec));
+    return fnv(h, &w.rocks.scale[0], ARRAY_MAX*sizeof(f32));
+}
+
+static void newWorld(unsigned int woken)
+{
+    sim_new(&w, NEWGAME_SEED);
+    w.pp = w.rocks.pos[ARRAY_MAX/2]; // touching a rock or two
+    for(unsigned int i = 0; i < ARRAY_MAX; i += 256)
+        w.rocks.free[i] = 2;
+    if(woken == 0)
+        return;
+    for(unsigned int i = 0; i+100 < ARRAY_MAX; i += 256)
+    {
+        for(unsigned int j = 6; j < 10; j++)
+            rockSleep(&w, i+j);
+        rockSleep(&w, i+100);
+    }
+    activeCompact(&w);
+    for(unsigned int i = 0; i+100 < ARRAY_MAX; i += 256)
+    {
+        rockWake(&w, i+6);
+        rockWake(&w, i+100);
+        rockWake(&w, i+8);
+        rockWake(&w, i+9);
+    }
+    w.stirred_num = 0;
+}
+
+// the whole step, grid & shield included
+static uint64_t stepHash(unsigned int frames)
+{
+    inp.keys[2] = 1;
+    for(unsigned int f = 0; f < frames; f++)
+    {
+        inp.xrot = w.pr;
+        sim_step(&w, &inp, SIM_DT);
+    }
+    return fnv(rockHash(), &w.ps, sizeof(f32));
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int frames = 600;
+    if(argc > 1)
+    {
+        char opt[32];
+        snprintf(opt, sizeof(opt), "rocks=%s", argv[1]);
+        sim_option(opt);
+    }
+    if(argc > 2){frames = atoi(argv[2]);}
+
+    poolInit(1);
+    if(sim_init(&w) == 0)
+    {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    steprun kernel[4] = {stepRunScalar};
+    const char* name[4] = {"scalar"};
+    unsigned int kernels = 1;
+#ifdef SIM_LANES
+    kernel[kernels] = stepRunVector, name[kernels++] = "vector";
+#if defined(__x86_64__) || defined(__i386__)
+    if(cpuFeatures() & CPU_SSE41)
+        kernel[kernels] = stepRunSSE4, name[kernels++] = "sse4";
+    if(cpuFeatures() & CPU_AVX2)
+        kernel[kernels] = stepRunAVX2, name[kernels++] = "avx2";
+#elif defined(CPU_NEON_TARGET)
+    if(cpuFeatures() & CPU_NEON)
+        kernel[kernels] = stepRunNEON, name[kernels++] = "neon";
+#endif
+#endif
+
+    printf("rocks:     %u x %u frames\n", ARRAY_MAX, frames);
+    double base = 0.0;
+    uint64_t base_run = 0, base_step = 0, base_woken = 0;
+    for(unsigned int k = 0; k < kernels; k++)
+    {
+        // the runs alone, the grid is kept up to date between frames but not timed
+        newWorld(0);
+        const unsigned int runs = (w.active_num + STEP_RUN-1) / STEP_RUN;
+        double t = 0.0;
+        uint64_t hr = 14695981039346656037ULL;
+        for(unsigned int f = 0; f < frames; f++)
+        {
+            const double st = now();
+            for(unsigned int c = 0; c < runs; c++)
+                kernel[k](&w, c, SIM_DT);
+            t += now() - st;
+            for(unsigned int c = 0; c < runs; c++)
+                hr = fnv(hr, &w.relink[c*STEP_RUN], w.run_relink[c]*sizeof(unsigned int));
+            relinkGrid(runs);
+        }
+        hr = fnv(hr, &w.run_so[0], runs*sizeof(f32)) ^ rockHash();
+
+        step_run = kernel[k];
+        newWorld(0);
+        const uint64_t hs = stepHash(frames);
+        newWorld(1);
+        const uint64_t hw = stepHash(frames);
+
+        if(k == 0)
+            base = t, base_run = hr, base_step = hs, base_woken = hw;
+        printf("%-8s %7.2f ns/rock, %.3f ms/frame, %.2fx, runs %016llx, steps %016llx, woken %016llx%s\n", name[k], t*1e9/((double)ARRAY_MAX*frames), t*1e3/frames, base/t,
+               (unsigned long long)hr, (unsigned long long)hs, (unsigned long long)hw, hr == base_run && hs == base_step && hw == base_woken ? "" : " MISMATCH");
+    }
+
+    sim_free(&w);
+    poolQuit();
+    return 0;
+}
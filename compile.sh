@@ -1,2 +1,2 @@
-clang main.c glad_gl.c -Ofast -lglfw -lm -o spaceminer
+clang main.c glad_gl.c -Ofast -lglfw -lm -lpthread -o spaceminer
 ./spaceminer
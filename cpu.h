@@ -0,0 +1,77 @@
+/*
+    CPU feature probe for the SIMD kernels in sim.h and mat.h.
+
+    cpuFeatures() asks the CPU once, cpuid through __builtin_cpu_supports()
+    on x86 and getauxval(AT_HWCAP) on 32-bit ARM Linux (Advanced SIMD is
+    part of ARMv8 so aarch64 always has it), and keeps the answer. Kernels
+    built with __attribute__((target())) are only bound when the CPU has
+    what they were built for, on 32-bit ARM that is a NEON build of the
+    kernels when the build itself only targets VFP.
+
+    cpuName() is the features found as one line for the startup log.
+*/
+
+#ifndef CPU_H
+#define CPU_H
+
+#include <string.h>
+#if defined(__linux__) && defined(__arm__)
+    #include <sys/auxv.h>
+#endif
+
+#define CPU_SSE2  1
+#define CPU_SSE41 2
+#define CPU_AVX2  4
+#define CPU_FMA   8
+#define CPU_NEON  16
+
+// 32-bit ARM hard float builds without -mfpu=neon, kernels get a target("fpu=neon") build too
+#if defined(__arm__) && !defined(__ARM_NEON) && !defined(__SOFTFP__)
+    #define CPU_NEON_TARGET
+#endif
+
+unsigned int cpuFeatures();
+const char* cpuName();
+
+//*************************************
+// implementation
+//*************************************
+unsigned int cpu_features = 0;
+unsigned int cpu_probed = 0;
+
+unsigned int cpuFeatures()
+{
+    if(cpu_probed == 1)
+        return cpu_features;
+    cpu_probed = 1;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse2")){cpu_features |= CPU_SSE2;}
+    if(__builtin_cpu_supports("sse4.1")){cpu_features |= CPU_SSE41;}
+    if(__builtin_cpu_supports("avx2")){cpu_features |= CPU_AVX2;}
+    if(__builtin_cpu_supports("fma")){cpu_features |= CPU_FMA;}
+#elif defined(__aarch64__)
+    cpu_features |= CPU_NEON;
+#elif defined(__linux__) && defined(__arm__)
+    if(getauxval(AT_HWCAP) & (1 << 12)) // HWCAP_NEON
+        cpu_features |= CPU_NEON;
+#endif
+    return cpu_features;
+}
+
+const char* cpuName()
+{
+    static char name[64];
+    const unsigned int f = cpuFeatures();
+    name[0] = 0x00;
+    if(f & CPU_SSE2){strcat(name, " sse2");}
+    if(f & CPU_SSE41){strcat(name, " sse4.1");}
+    if(f & CPU_AVX2){strcat(name, " avx2");}
+    if(f & CPU_FMA){strcat(name, " fma");}
+    if(f & CPU_NEON){strcat(name, " neon");}
+    if(name[0] == 0x00)
+        return "none";
+    return name+1;
+}
+
+#endif
@@ -8,6 +8,26 @@
         - vec.h: https://gist.github.com/mrbid/77a92019e1ab8b86109bf103166bd04e
         - mat.h: https://gist.github.com/mrbid/cbc69ec9d99b0fda44204975fcbeae7c
 
+    v2.5:
+        - added a colour array pair lambert (makeLambert3N) that picks the near colour array
+          per vertex when its centre attribute is within a radius of a point
+
+    v2.4:
+        - added point sprite impostors (makeImpostor) lit from an atlas of view space normals,
+          and a view space normal shader (makeNormal) to bake that atlas with
+
+    v2.3:
+        - added solid colour per part lambert (makeLambert1P), a model of up to ES_MAX_PARTS rigid
+          parts in one draw, with a part id array (ESModel pid) indexing modelview & colour arrays
+
+    v2.2:
+        - ESModel carries a vertex array object (GL 3.0), built once by esBindModel() or esModelVAO()
+        - fixed attribute locations for every shader so one VAO works with any of them
+        - state cache for programs, array buffers, VAOs & uniforms that drops redundant calls
+
+    v2.1:
+        - added colour array + normal array lambert with per-instance offset & spin (makeLambert3I)
+
     v2.0:
         - added support for fullbright texture mapping
 
@@ -43,8 +63,22 @@ typedef struct
     GLuint cid;	// Colour Array Buffer ID
     GLuint nid;	// Normal Array Buffer ID
     GLuint tid;	// TexCoord Array Buffer ID
+    GLuint pid; // Part ID Array Buffer ID, one float per vertex
+    GLuint vao; // Vertex Array Object ID, 0 without GL 3.0
 } ESModel;
 
+// every shader binds its attributes to these locations, see esBindAttribs()
+#define ES_ATTRIB_POSITION 0
+#define ES_ATTRIB_NORMAL   1
+#define ES_ATTRIB_COLOR    2
+#define ES_ATTRIB_OFFSET   3
+#define ES_ATTRIB_SPIN     4
+#define ES_ATTRIB_PART     5
+#define ES_ATTRIB_NEARCOL  6
+#define ES_ATTRIB_CENTRE   7
+
+#define ES_MAX_PARTS 16 // modelview & colour array size of makeLambert1P()
+
 //*************************************
 // UTILITY
 //*************************************
@@ -53,20 +87,49 @@ GLuint esRand(const GLuint min, const GLuint max);
 GLfloat esRandFloat(const GLfloat min, const GLfloat max);
 void esBind(const GLenum target, GLuint* buffer, const void* data, const GLsizeiptr datalen, const GLenum usage);
 void esBindModel(ESModel* model, const GLfloat* vertices, const GLsizei vertlen, const GLushort* indices, const GLsizei indlen);
+void esModelVAO(ESModel* model);      // records vid, nid, cid & iid into model->vao, call once after binding them
+void esUseModel(const ESModel* model); // binds the model for glDrawElements(), its VAO if it has one
 GLuint esLoadTexture(const GLuint w, const GLuint h, const unsigned char* data);
 GLuint esLoadTextureA(const GLuint w, const GLuint h, const unsigned char* data);
 
+//*************************************
+// STATE CACHE
+//*************************************
+// drops binds & uniform uploads that would not change anything, every
+// program, GL_ARRAY_BUFFER & VAO bind must go through here to keep it true
+
+void esUseProgram(const GLuint program);
+void esBindBuffer(const GLenum target, const GLuint buffer); // only GL_ARRAY_BUFFER is cached
+void esBindVertexArray(const GLuint vao);
+void esUniform1f(const GLint location, const GLfloat x);
+void esUniform3f(const GLint location, const GLfloat x, const GLfloat y, const GLfloat z);
+void esUniformMatrix4fv(const GLint location, const GLfloat* m);
+void esStateReset(); // forget everything, after GL calls made behind the cache's back
+
+typedef struct
+{
+    unsigned long long binds, binds_skipped;       // programs, buffers & VAOs
+    unsigned long long uniforms, uniforms_skipped;
+} ESStateStats;
+ESStateStats esStateStats(); // since the last call
+
 //*************************************
 // SHADER
 //*************************************
 
 void makeAllShaders();
+void esBindAttribs(const GLuint program); // before glLinkProgram()
 
 void makeFullbright();
 void makeLambert();
 void makeLambert1();
 void makeLambert2();
 void makeLambert3();
+void makeLambert3I();
+void makeLambert1P();
+void makeLambert3N();
+void makeImpostor();
+void makeNormal();
 void makePhong();
 void makePhong1();
 void makePhong2();
@@ -79,6 +142,11 @@ void shadeLambert(GLint* position, GLint* projection, GLint* modelview, GLint* l
 void shadeLambert1(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity);   // solid color + normals
 void shadeLambert2(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* color, GLint* opacity);                  // colors + no normals
 void shadeLambert3(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity);   // colors + normals
+void shadeLambert3I(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity, GLint* offset, GLint* spin, GLint* time); // colors + normals + per-instance offset/scale/spin
+void shadeLambert1P(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* part); // solid color per part + normals, modelview[] & color[] (rgb + opacity) are arrays
+void shadeLambert3N(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity, GLint* nearcol, GLint* centre, GLint* nearpos, GLint* nearradius); // colors or near colors + normals, picked by centre's distance to nearpos
+void shadeImpostor(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* color, GLint* spin, GLint* time, GLint* pointscale, GLint* atlas, GLint* sampler); // solid color + normal atlas, one point sprite per position
+void shadeNormal(GLint* position, GLint* projection, GLint* modelview, GLint* normal); // view space normal as colour, for baking impostor atlases
 
 void shadePhong(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* color, GLint* opacity);                   // solid color + no normals
 void shadePhong1(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity);   // solid color + normals
@@ -104,7 +172,9 @@ GLfloat esRandFloat(const GLfloat min, const GLfloat max)
 void esBind(const GLenum target, GLuint* buffer, const void* data, const GLsizeiptr datalen, const GLenum usage)
 {
     glGenBuffers(1, buffer);
-    glBindBuffer(target, *buffer);
+    if(target == GL_ELEMENT_ARRAY_BUFFER)
+        esBindVertexArray(0); // or it would be recorded into whatever VAO is bound
+    esBindBuffer(target, *buffer);
     glBufferData(target, datalen, data, usage);
 }
 
@@ -112,6 +182,188 @@ void esBindModel(ESModel* model, const GLfloat* vertices, const GLsizei vertlen,
 {
     esBind(GL_ARRAY_BUFFER, &model->vid, vertices, vertlen * sizeof(GLfloat) * 3, GL_STATIC_DRAW);
     esBind(GL_ELEMENT_ARRAY_BUFFER, &model->iid, indices, indlen * sizeof(GLushort), GL_STATIC_DRAW);
+    esModelVAO(model);
+}
+
+static void esModelAttribs(const ESModel* model)
+{
+    esBindBuffer(GL_ARRAY_BUFFER, model->vid);
+    glVertexAttribPointer(ES_ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(ES_ATTRIB_POSITION);
+
+    if(model->nid != 0)
+    {
+        esBindBuffer(GL_ARRAY_BUFFER, model->nid);
+        glVertexAttribPointer(ES_ATTRIB_NORMAL, 3, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(ES_ATTRIB_NORMAL);
+    }
+
+    if(model->cid != 0)
+    {
+        esBindBuffer(GL_ARRAY_BUFFER, model->cid);
+        glVertexAttribPointer(ES_ATTRIB_COLOR, 3, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(ES_ATTRIB_COLOR);
+    }
+
+    if(model->pid != 0)
+    {
+        esBindBuffer(GL_ARRAY_BUFFER, model->pid);
+        glVertexAttribPointer(ES_ATTRIB_PART, 1, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(ES_ATTRIB_PART);
+    }
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, model->iid);
+}
+
+void esModelVAO(ESModel* model)
+{
+    if(glGenVertexArrays == NULL) // GL 2.x, esUseModel() sets the attributes up each time instead
+        return;
+    if(model->vao == 0)
+        glGenVertexArrays(1, &model->vao);
+    esBindVertexArray(model->vao);
+    esModelAttribs(model);
+    esBindVertexArray(0);
+}
+
+void esUseModel(const ESModel* model)
+{
+    if(model->vao != 0)
+        esBindVertexArray(model->vao);
+    else
+        esModelAttribs(model);
+}
+
+//*************************************
+// STATE CACHE CODE
+//*************************************
+
+#define ES_CACHE_PROGRAMS 16
+#define ES_CACHE_UNIFORMS 32
+
+typedef struct
+{
+    GLuint program;
+    GLsizei size[ES_CACHE_UNIFORMS]; // floats held, 0 = unknown
+    GLfloat value[ES_CACHE_UNIFORMS][16];
+} ESProgramCache;
+
+typedef struct
+{
+    GLuint program, buffer, vao;
+    ESProgramCache prog[ES_CACHE_PROGRAMS];
+    ESProgramCache* cur;
+    ESStateStats stats;
+} ESStateCache;
+ESStateCache es_state = {0};
+
+void esUseProgram(const GLuint program)
+{
+    es_state.stats.binds++;
+    if(es_state.cur != NULL && program == es_state.program)
+    {
+        es_state.stats.binds_skipped++;
+        return;
+    }
+    glUseProgram(program);
+    es_state.program = program;
+
+    // uniforms belong to the program, find its values or take a free slot
+    es_state.cur = NULL;
+    for(int i = 0; i < ES_CACHE_PROGRAMS; i++)
+    {
+        if(es_state.prog[i].program == program)
+        {
+            es_state.cur = &es_state.prog[i];
+            return;
+        }
+        if(es_state.prog[i].program == 0)
+        {
+            es_state.prog[i].program = program;
+            es_state.cur = &es_state.prog[i];
+            return;
+        }
+    }
+}
+
+void esBindBuffer(const GLenum target, const GLuint buffer)
+{
+    if(target != GL_ARRAY_BUFFER)
+    {
+        glBindBuffer(target, buffer);
+        return;
+    }
+    es_state.stats.binds++;
+    if(buffer == es_state.buffer)
+    {
+        es_state.stats.binds_skipped++;
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    es_state.buffer = buffer;
+}
+
+void esBindVertexArray(const GLuint vao)
+{
+    if(glBindVertexArray == NULL)
+        return;
+    es_state.stats.binds++;
+    if(vao == es_state.vao)
+    {
+        es_state.stats.binds_skipped++;
+        return;
+    }
+    glBindVertexArray(vao);
+    es_state.vao = vao;
+}
+
+// returns 1 when the uniform already holds these n floats, else remembers them
+static int esUniformCached(const GLint location, const GLfloat* v, const GLsizei n)
+{
+    es_state.stats.uniforms++;
+    if(es_state.cur == NULL || location < 0 || location >= ES_CACHE_UNIFORMS)
+        return 0;
+    if(es_state.cur->size[location] == n && memcmp(es_state.cur->value[location], v, n*sizeof(GLfloat)) == 0)
+    {
+        es_state.stats.uniforms_skipped++;
+        return 1;
+    }
+    es_state.cur->size[location] = n;
+    memcpy(es_state.cur->value[location], v, n*sizeof(GLfloat));
+    return 0;
+}
+
+void esUniform1f(const GLint location, const GLfloat x)
+{
+    if(esUniformCached(location, &x, 1) == 0)
+        glUniform1f(location, x);
+}
+
+void esUniform3f(const GLint location, const GLfloat x, const GLfloat y, const GLfloat z)
+{
+    const GLfloat v[3] = {x, y, z};
+    if(esUniformCached(location, &v[0], 3) == 0)
+        glUniform3f(location, x, y, z);
+}
+
+void esUniformMatrix4fv(const GLint location, const GLfloat* m)
+{
+    if(esUniformCached(location, m, 16) == 0)
+        glUniformMatrix4fv(location, 1, GL_FALSE, m);
+}
+
+void esStateReset()
+{
+    const ESStateStats stats = es_state.stats;
+    memset(&es_state, 0, sizeof(ESStateCache));
+    es_state.stats = stats;
+}
+
+ESStateStats esStateStats()
+{
+    const ESStateStats stats = es_state.stats;
+    memset(&es_state.stats, 0, sizeof(ESStateStats));
+    return stats;
 }
 
 GLuint esLoadTexture(const GLuint w, const GLuint h, const unsigned char* data)
@@ -308,6 +560,186 @@ const GLchar* v13 =
         "gl_Position = projection * modelview * position;\n"
     "}\n";
 
+// color array + normal array + per-instance offset & spin
+// offset = (x, y, z, scale), spin = (axis selector, rate, speed, 0)
+// the modelview uniform is just the view matrix here, the model
+// matrix is built from offset and spin with an angle of
+// rate*speed*time, selector < 100 = Y*Z*X, < 200 = Z*X, < 300 = X,
+// else no spin (same order as mRotY/mRotZ/mRotX), offset & spin can
+// be per-instance arrays or constant attributes set with glVertexAttrib
+const GLchar* v14 =
+    "#version 100\n"
+    "uniform mat4 modelview;\n"
+    "uniform mat4 projection;\n"
+    "uniform float opacity;\n"
+    "uniform vec3 lightpos;\n"
+    "uniform float time;\n"
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute vec3 color;\n"
+    "attribute vec4 offset;\n"
+    "attribute vec4 spin;\n"
+    "varying vec3 vertPos;\n"
+    "varying vec3 vertNorm;\n"
+    "varying vec3 vertCol;\n"
+    "varying float vertOpa;\n"
+    "varying vec3 vlightPos;\n"
+    "void main()\n"
+    "{\n"
+        "mat3 rot = mat3(1.0);\n"
+        "if(spin.x < 300.0)\n"
+        "{\n"
+            "float a = spin.y * spin.z * time;\n"
+            "float s = sin(a);\n"
+            "float c = cos(a);\n"
+            "if(spin.x < 100.0)\n"
+                "rot = rot * mat3(1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c);\n"
+            "if(spin.x < 200.0)\n"
+                "rot = rot * mat3(c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0);\n"
+            "rot = rot * mat3(c, 0.0, s, 0.0, 1.0, 0.0, -s, 0.0, c);\n"
+        "}\n"
+        "vec4 vertPos4 = modelview * vec4(rot * (position.xyz * offset.w) + offset.xyz, 1.0);\n"
+        "vertPos = vec3(vertPos4) / vertPos4.w;\n"
+        "vertNorm = vec3(modelview * vec4(rot * normal, 0.0));\n"
+        "vertCol = color;\n"
+        "vertOpa = opacity;\n"
+        "vlightPos = lightpos;\n"
+        "gl_Position = projection * vertPos4;\n"
+    "}\n";
+
+// solid color per part + normal array
+// part indexes the modelview & color (rgb + opacity) arrays, so a model
+// of up to ES_MAX_PARTS rigidly moving parts is one draw
+const GLchar* v15 =
+    "#version 100\n"
+    "uniform mat4 modelview[16];\n"
+    "uniform mat4 projection;\n"
+    "uniform vec4 color[16];\n"
+    "uniform vec3 lightpos;\n"
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute float part;\n"
+    "varying vec3 vertPos;\n"
+    "varying vec3 vertNorm;\n"
+    "varying vec3 vertCol;\n"
+    "varying float vertOpa;\n"
+    "varying vec3 vlightPos;\n"
+    "void main()\n"
+    "{\n"
+        "int p = int(part + 0.5);\n"
+        "mat4 mv = modelview[p];\n"
+        "vec4 vertPos4 = mv * position;\n"
+        "vertPos = vec3(vertPos4) / vertPos4.w;\n"
+        "vertNorm = vec3(mv * vec4(normal.xyz, 0.0));\n"
+        "vertCol = color[p].rgb;\n"
+        "vertOpa = color[p].a;\n"
+        "vlightPos = lightpos;\n"
+        "gl_Position = projection * mv * position;\n"
+    "}\n";
+
+// color array pair + normal array, nearcol instead of color for the
+// vertices whose centre is within nearradius of nearpos, so a batch
+// of baked models can each show the colours they would on their own
+const GLchar* v18 =
+    "#version 100\n"
+    "uniform mat4 modelview;\n"
+    "uniform mat4 projection;\n"
+    "uniform float opacity;\n"
+    "uniform vec3 lightpos;\n"
+    "uniform vec3 nearpos;\n"
+    "uniform float nearradius;\n"
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "attribute vec3 color;\n"
+    "attribute vec3 nearcol;\n"
+    "attribute vec3 centre;\n"
+    "varying vec3 vertPos;\n"
+    "varying vec3 vertNorm;\n"
+    "varying vec3 vertCol;\n"
+    "varying float vertOpa;\n"
+    "varying vec3 vlightPos;\n"
+    "void main()\n"
+    "{\n"
+        "vec4 vertPos4 = modelview * position;\n"
+        "vertPos = vec3(vertPos4) / vertPos4.w;\n"
+        "vertNorm = vec3(modelview * vec4(normal.xyz, 0.0));\n"
+        "vertCol = distance(centre, nearpos) < nearradius ? nearcol : color;\n"
+        "vertOpa = opacity;\n"
+        "vlightPos = lightpos;\n"
+        "gl_Position = projection * vertPos4;\n"
+    "}\n";
+
+// point sprite impostor, position = (x, y, z, scale), spin as in v14
+// with the atlas row in spin.w, the spin angle picks the atlas column
+// so the sprite turns through the baked views, pointscale is the
+// sprite diameter at a distance of one for a scale of one
+const GLchar* v16 =
+    "#version 100\n"
+    "uniform mat4 modelview;\n"
+    "uniform mat4 projection;\n"
+    "uniform vec3 lightpos;\n"
+    "uniform float time;\n"
+    "uniform float pointscale;\n"
+    "uniform mediump vec2 atlas;\n"
+    "attribute vec4 position;\n"
+    "attribute vec4 spin;\n"
+    "varying vec3 vertPos;\n"
+    "varying vec2 vertCell;\n"
+    "varying vec3 vlightPos;\n"
+    "void main()\n"
+    "{\n"
+        "vec4 vertPos4 = modelview * vec4(position.xyz, 1.0);\n"
+        "vertPos = vec3(vertPos4) / vertPos4.w;\n"
+        "float a = spin.x < 300.0 ? fract(spin.y * spin.z * time * 0.159154943) : 0.0;\n"
+        "vertCell = vec2(floor(a / atlas.x), spin.w);\n"
+        "vlightPos = lightpos;\n"
+        "gl_PointSize = max(pointscale * position.w / -vertPos4.z, 1.0);\n"
+        "gl_Position = projection * vertPos4;\n"
+    "}\n";
+
+const GLchar* f3 =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "uniform sampler2D tex;\n"
+    "uniform vec3 color;\n"
+    "uniform vec2 atlas;\n"
+    "varying vec3 vertPos;\n"
+    "varying vec2 vertCell;\n"
+    "varying vec3 vlightPos;\n"
+    "void main()\n"
+    "{\n"
+        "vec4 n = texture2D(tex, (vertCell + vec2(gl_PointCoord.x, 1.0 - gl_PointCoord.y)) * atlas);\n"
+        "if(n.a < 0.5)\n"
+            "discard;\n"
+        "vec3 normal = normalize(n.xyz * 2.0 - 1.0);\n"
+        "vec3 lightDir = normalize(vlightPos - vertPos);\n"
+        "float lambertian = max(dot(lightDir,normal), 0.0);\n"
+        "gl_FragColor = vec4(color * 0.148 + lambertian*color, 1.0);\n"
+    "}\n";
+
+// normal array to colour, for baking
+const GLchar* v17 =
+    "#version 100\n"
+    "uniform mat4 modelview;\n"
+    "uniform mat4 projection;\n"
+    "attribute vec4 position;\n"
+    "attribute vec3 normal;\n"
+    "varying vec3 vertNorm;\n"
+    "void main()\n"
+    "{\n"
+        "vertNorm = vec3(modelview * vec4(normal.xyz, 0.0));\n"
+        "gl_Position = projection * modelview * position;\n"
+    "}\n";
+
+const GLchar* f4 =
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec3 vertNorm;\n"
+    "void main()\n"
+    "{\n"
+        "gl_FragColor = vec4(normalize(vertNorm) * 0.5 + 0.5, 1.0);\n"
+    "}\n";
+
 const GLchar* f1 =
     "#version 100\n"
     "precision mediump float;\n"
@@ -508,6 +940,53 @@ GLint  shdLambert3_modelview;
 GLint  shdLambert3_lightpos;
 GLint  shdLambert3_color;
 GLint  shdLambert3_opacity;
+GLuint shdLambert3I;
+GLint  shdLambert3I_position;
+GLint  shdLambert3I_projection;
+GLint  shdLambert3I_modelview;
+GLint  shdLambert3I_lightpos;
+GLint  shdLambert3I_color;
+GLint  shdLambert3I_normal;
+GLint  shdLambert3I_opacity;
+GLint  shdLambert3I_offset;
+GLint  shdLambert3I_spin;
+GLint  shdLambert3I_time;
+GLuint shdLambert1P;
+GLint  shdLambert1P_position;
+GLint  shdLambert1P_projection;
+GLint  shdLambert1P_modelview;
+GLint  shdLambert1P_lightpos;
+GLint  shdLambert1P_color;
+GLint  shdLambert1P_normal;
+GLint  shdLambert1P_part;
+GLuint shdLambert3N;
+GLint  shdLambert3N_position;
+GLint  shdLambert3N_projection;
+GLint  shdLambert3N_modelview;
+GLint  shdLambert3N_lightpos;
+GLint  shdLambert3N_color;
+GLint  shdLambert3N_normal;
+GLint  shdLambert3N_opacity;
+GLint  shdLambert3N_nearcol;
+GLint  shdLambert3N_centre;
+GLint  shdLambert3N_nearpos;
+GLint  shdLambert3N_nearradius;
+GLuint shdImpostor;
+GLint  shdImpostor_position;
+GLint  shdImpostor_projection;
+GLint  shdImpostor_modelview;
+GLint  shdImpostor_lightpos;
+GLint  shdImpostor_color;
+GLint  shdImpostor_spin;
+GLint  shdImpostor_time;
+GLint  shdImpostor_pointscale;
+GLint  shdImpostor_atlas;
+GLint  shdImpostor_sampler;
+GLuint shdNormal;
+GLint  shdNormal_position;
+GLint  shdNormal_projection;
+GLint  shdNormal_modelview;
+GLint  shdNormal_normal;
 GLuint shdPhong;
 GLint  shdPhong_position;
 GLint  shdPhong_projection;
@@ -544,6 +1023,18 @@ GLint  shdPhong3_normal;
 GLint  shdPhong3_opacity;
 
 //
+void esBindAttribs(const GLuint program)
+{
+    glBindAttribLocation(program, ES_ATTRIB_POSITION, "position");
+    glBindAttribLocation(program, ES_ATTRIB_NORMAL, "normal");
+    glBindAttribLocation(program, ES_ATTRIB_COLOR, "color");
+    glBindAttribLocation(program, ES_ATTRIB_OFFSET, "offset"); // offset & spin can be constant attributes, they must never alias attribute 0
+    glBindAttribLocation(program, ES_ATTRIB_SPIN, "spin");
+    glBindAttribLocation(program, ES_ATTRIB_PART, "part");
+    glBindAttribLocation(program, ES_ATTRIB_NEARCOL, "nearcol");
+    glBindAttribLocation(program, ES_ATTRIB_CENTRE, "centre");
+}
+
 void makeFullbrightT()
 {
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
@@ -557,6 +1048,7 @@ void makeFullbrightT()
     shdFullbrightT = glCreateProgram();
         glAttachShader(shdFullbrightT, vertexShader);
         glAttachShader(shdFullbrightT, fragmentShader);
+    esBindAttribs(shdFullbrightT);
     glLinkProgram(shdFullbrightT);
 
     shdFullbrightT_position   = glGetAttribLocation(shdFullbrightT,  "position");
@@ -581,6 +1073,7 @@ void makeFullbright()
     shdFullbright = glCreateProgram();
         glAttachShader(shdFullbright, vertexShader);
         glAttachShader(shdFullbright, fragmentShader);
+    esBindAttribs(shdFullbright);
     glLinkProgram(shdFullbright);
 
     shdFullbright_position = glGetAttribLocation(shdFullbright, "position");
@@ -604,6 +1097,7 @@ void makeLambert()
     shdLambert = glCreateProgram();
         glAttachShader(shdLambert, vertexShader);
         glAttachShader(shdLambert, fragmentShader);
+    esBindAttribs(shdLambert);
     glLinkProgram(shdLambert);
 
     shdLambert_position = glGetAttribLocation(shdLambert, "position");
@@ -628,6 +1122,7 @@ void makeLambert1()
     shdLambert1 = glCreateProgram();
         glAttachShader(shdLambert1, vertexShader);
         glAttachShader(shdLambert1, fragmentShader);
+    esBindAttribs(shdLambert1);
     glLinkProgram(shdLambert1);
 
     shdLambert1_position = glGetAttribLocation(shdLambert1, "position");
@@ -653,6 +1148,7 @@ void makeLambert2()
     shdLambert3 = glCreateProgram();
         glAttachShader(shdLambert3, vertexShader);
         glAttachShader(shdLambert3, fragmentShader);
+    esBindAttribs(shdLambert3);
     glLinkProgram(shdLambert3);
 
     shdLambert3_position = glGetAttribLocation(shdLambert3, "position");
@@ -677,6 +1173,7 @@ void makeLambert3()
     shdLambert2 = glCreateProgram();
         glAttachShader(shdLambert2, vertexShader);
         glAttachShader(shdLambert2, fragmentShader);
+    esBindAttribs(shdLambert2);
     glLinkProgram(shdLambert2);
 
     shdLambert2_position = glGetAttribLocation(shdLambert2, "position");
@@ -689,6 +1186,143 @@ void makeLambert3()
     shdLambert2_opacity = glGetUniformLocation(shdLambert2, "opacity");
 }
 
+void makeLambert3I()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v14, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f1, NULL);
+    glCompileShader(fragmentShader);
+
+    shdLambert3I = glCreateProgram();
+        glAttachShader(shdLambert3I, vertexShader);
+        glAttachShader(shdLambert3I, fragmentShader);
+    esBindAttribs(shdLambert3I);
+    glLinkProgram(shdLambert3I);
+
+    shdLambert3I_position = glGetAttribLocation(shdLambert3I, "position");
+    shdLambert3I_normal = glGetAttribLocation(shdLambert3I, "normal");
+    shdLambert3I_color = glGetAttribLocation(shdLambert3I, "color");
+    shdLambert3I_offset = glGetAttribLocation(shdLambert3I, "offset");
+    shdLambert3I_spin = glGetAttribLocation(shdLambert3I, "spin");
+    
+    shdLambert3I_projection = glGetUniformLocation(shdLambert3I, "projection");
+    shdLambert3I_modelview = glGetUniformLocation(shdLambert3I, "modelview");
+    shdLambert3I_lightpos = glGetUniformLocation(shdLambert3I, "lightpos");
+    shdLambert3I_opacity = glGetUniformLocation(shdLambert3I, "opacity");
+    shdLambert3I_time = glGetUniformLocation(shdLambert3I, "time");
+}
+
+void makeLambert1P()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v15, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f1, NULL);
+    glCompileShader(fragmentShader);
+
+    shdLambert1P = glCreateProgram();
+        glAttachShader(shdLambert1P, vertexShader);
+        glAttachShader(shdLambert1P, fragmentShader);
+    esBindAttribs(shdLambert1P);
+    glLinkProgram(shdLambert1P);
+
+    shdLambert1P_position = glGetAttribLocation(shdLambert1P, "position");
+    shdLambert1P_normal = glGetAttribLocation(shdLambert1P, "normal");
+    shdLambert1P_part = glGetAttribLocation(shdLambert1P, "part");
+    
+    shdLambert1P_projection = glGetUniformLocation(shdLambert1P, "projection");
+    shdLambert1P_modelview = glGetUniformLocation(shdLambert1P, "modelview");
+    shdLambert1P_lightpos = glGetUniformLocation(shdLambert1P, "lightpos");
+    shdLambert1P_color = glGetUniformLocation(shdLambert1P, "color");
+}
+
+void makeLambert3N()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v18, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f1, NULL);
+    glCompileShader(fragmentShader);
+
+    shdLambert3N = glCreateProgram();
+        glAttachShader(shdLambert3N, vertexShader);
+        glAttachShader(shdLambert3N, fragmentShader);
+    esBindAttribs(shdLambert3N);
+    glLinkProgram(shdLambert3N);
+
+    shdLambert3N_position = glGetAttribLocation(shdLambert3N, "position");
+    shdLambert3N_normal = glGetAttribLocation(shdLambert3N, "normal");
+    shdLambert3N_color = glGetAttribLocation(shdLambert3N, "color");
+    shdLambert3N_nearcol = glGetAttribLocation(shdLambert3N, "nearcol");
+    shdLambert3N_centre = glGetAttribLocation(shdLambert3N, "centre");
+    
+    shdLambert3N_projection = glGetUniformLocation(shdLambert3N, "projection");
+    shdLambert3N_modelview = glGetUniformLocation(shdLambert3N, "modelview");
+    shdLambert3N_lightpos = glGetUniformLocation(shdLambert3N, "lightpos");
+    shdLambert3N_opacity = glGetUniformLocation(shdLambert3N, "opacity");
+    shdLambert3N_nearpos = glGetUniformLocation(shdLambert3N, "nearpos");
+    shdLambert3N_nearradius = glGetUniformLocation(shdLambert3N, "nearradius");
+}
+
+void makeImpostor()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v16, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f3, NULL);
+    glCompileShader(fragmentShader);
+
+    shdImpostor = glCreateProgram();
+        glAttachShader(shdImpostor, vertexShader);
+        glAttachShader(shdImpostor, fragmentShader);
+    esBindAttribs(shdImpostor);
+    glLinkProgram(shdImpostor);
+
+    shdImpostor_position = glGetAttribLocation(shdImpostor, "position");
+    shdImpostor_spin = glGetAttribLocation(shdImpostor, "spin");
+    
+    shdImpostor_projection = glGetUniformLocation(shdImpostor, "projection");
+    shdImpostor_modelview = glGetUniformLocation(shdImpostor, "modelview");
+    shdImpostor_lightpos = glGetUniformLocation(shdImpostor, "lightpos");
+    shdImpostor_color = glGetUniformLocation(shdImpostor, "color");
+    shdImpostor_time = glGetUniformLocation(shdImpostor, "time");
+    shdImpostor_pointscale = glGetUniformLocation(shdImpostor, "pointscale");
+    shdImpostor_atlas = glGetUniformLocation(shdImpostor, "atlas");
+    shdImpostor_sampler = glGetUniformLocation(shdImpostor, "tex");
+}
+
+void makeNormal()
+{
+    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertexShader, 1, &v17, NULL);
+    glCompileShader(vertexShader);
+
+    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragmentShader, 1, &f4, NULL);
+    glCompileShader(fragmentShader);
+
+    shdNormal = glCreateProgram();
+        glAttachShader(shdNormal, vertexShader);
+        glAttachShader(shdNormal, fragmentShader);
+    esBindAttribs(shdNormal);
+    glLinkProgram(shdNormal);
+
+    shdNormal_position = glGetAttribLocation(shdNormal, "position");
+    shdNormal_normal = glGetAttribLocation(shdNormal, "normal");
+    
+    shdNormal_projection = glGetUniformLocation(shdNormal, "projection");
+    shdNormal_modelview = glGetUniformLocation(shdNormal, "modelview");
+}
+
 void makePhong()
 {
     GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
@@ -702,6 +1336,7 @@ void makePhong()
     shdPhong = glCreateProgram();
         glAttachShader(shdPhong, vertexShader);
         glAttachShader(shdPhong, fragmentShader);
+    esBindAttribs(shdPhong);
     glLinkProgram(shdPhong);
 
     shdPhong_position = glGetAttribLocation(shdPhong, "position");
@@ -727,6 +1362,7 @@ void makePhong1()
     shdPhong1 = glCreateProgram();
         glAttachShader(shdPhong1, vertexShader);
         glAttachShader(shdPhong1, fragmentShader);
+    esBindAttribs(shdPhong1);
     glLinkProgram(shdPhong1);
 
     shdPhong1_position = glGetAttribLocation(shdPhong1, "position");
@@ -753,6 +1389,7 @@ void makePhong2()
     shdPhong2 = glCreateProgram();
         glAttachShader(shdPhong2, vertexShader);
         glAttachShader(shdPhong2, fragmentShader);
+    esBindAttribs(shdPhong2);
     glLinkProgram(shdPhong2);
 
     shdPhong2_position = glGetAttribLocation(shdPhong2, "position");
@@ -778,6 +1415,7 @@ void makePhong3()
     shdPhong3 = glCreateProgram();
         glAttachShader(shdPhong3, vertexShader);
         glAttachShader(shdPhong3, fragmentShader);
+    esBindAttribs(shdPhong3);
     glLinkProgram(shdPhong3);
 
     shdPhong3_position = glGetAttribLocation(shdPhong3, "position");
@@ -799,6 +1437,11 @@ void makeAllShaders()
     makeLambert1();
     makeLambert2();
     makeLambert3();
+    makeLambert3I();
+    makeLambert1P();
+    makeLambert3N();
+    makeImpostor();
+    makeNormal();
     makePhong();
     makePhong1();
     makePhong2();
@@ -812,7 +1455,7 @@ void shadeFullbrightT(GLint* position, GLint* projection, GLint* modelview, GLin
     *modelview = shdFullbrightT_modelview;
     *texcoord = shdFullbrightT_texcoord;
     *sampler = shdFullbrightT_sampler;
-    glUseProgram(shdFullbrightT);
+    esUseProgram(shdFullbrightT);
 }
 
 void shadeFullbright(GLint* position, GLint* projection, GLint* modelview, GLint* color, GLint* opacity)
@@ -822,7 +1465,7 @@ void shadeFullbright(GLint* position, GLint* projection, GLint* modelview, GLint
     *modelview = shdFullbright_modelview;
     *color = shdFullbright_color;
     *opacity = shdFullbright_opacity;
-    glUseProgram(shdFullbright);
+    esUseProgram(shdFullbright);
 }
 
 void shadeLambert(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* color, GLint* opacity)
@@ -833,7 +1476,7 @@ void shadeLambert(GLint* position, GLint* projection, GLint* modelview, GLint* l
     *lightpos = shdLambert_lightpos;
     *color = shdLambert_color;
     *opacity = shdLambert_opacity;
-    glUseProgram(shdLambert);
+    esUseProgram(shdLambert);
 }
 
 void shadeLambert1(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity)
@@ -845,7 +1488,7 @@ void shadeLambert1(GLint* position, GLint* projection, GLint* modelview, GLint*
     *color = shdLambert1_color;
     *normal = shdLambert1_normal;
     *opacity = shdLambert1_opacity;
-    glUseProgram(shdLambert1);
+    esUseProgram(shdLambert1);
 }
 
 // notice: swapped this from 2 to 3
@@ -858,7 +1501,74 @@ void shadeLambert3(GLint* position, GLint* projection, GLint* modelview, GLint*
     *color = shdLambert2_color;
     *normal = shdLambert2_normal;
     *opacity = shdLambert2_opacity;
-    glUseProgram(shdLambert2);
+    esUseProgram(shdLambert2);
+}
+
+void shadeLambert3I(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity, GLint* offset, GLint* spin, GLint* time)
+{
+    *position = shdLambert3I_position;
+    *projection = shdLambert3I_projection;
+    *modelview = shdLambert3I_modelview;
+    *lightpos = shdLambert3I_lightpos;
+    *color = shdLambert3I_color;
+    *normal = shdLambert3I_normal;
+    *opacity = shdLambert3I_opacity;
+    *offset = shdLambert3I_offset;
+    *spin = shdLambert3I_spin;
+    *time = shdLambert3I_time;
+    esUseProgram(shdLambert3I);
+}
+
+void shadeLambert1P(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* part)
+{
+    *position = shdLambert1P_position;
+    *projection = shdLambert1P_projection;
+    *modelview = shdLambert1P_modelview;
+    *lightpos = shdLambert1P_lightpos;
+    *color = shdLambert1P_color;
+    *normal = shdLambert1P_normal;
+    *part = shdLambert1P_part;
+    esUseProgram(shdLambert1P);
+}
+
+void shadeLambert3N(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity, GLint* nearcol, GLint* centre, GLint* nearpos, GLint* nearradius)
+{
+    *position = shdLambert3N_position;
+    *projection = shdLambert3N_projection;
+    *modelview = shdLambert3N_modelview;
+    *lightpos = shdLambert3N_lightpos;
+    *color = shdLambert3N_color;
+    *normal = shdLambert3N_normal;
+    *opacity = shdLambert3N_opacity;
+    *nearcol = shdLambert3N_nearcol;
+    *centre = shdLambert3N_centre;
+    *nearpos = shdLambert3N_nearpos;
+    *nearradius = shdLambert3N_nearradius;
+    esUseProgram(shdLambert3N);
+}
+
+void shadeImpostor(GLint* position, GLint* projection, GLint* modelview, GLint* lightpos, GLint* color, GLint* spin, GLint* time, GLint* pointscale, GLint* atlas, GLint* sampler)
+{
+    *position = shdImpostor_position;
+    *projection = shdImpostor_projection;
+    *modelview = shdImpostor_modelview;
+    *lightpos = shdImpostor_lightpos;
+    *color = shdImpostor_color;
+    *spin = shdImpostor_spin;
+    *time = shdImpostor_time;
+    *pointscale = shdImpostor_pointscale;
+    *atlas = shdImpostor_atlas;
+    *sampler = shdImpostor_sampler;
+    esUseProgram(shdImpostor);
+}
+
+void shadeNormal(GLint* position, GLint* projection, GLint* modelview, GLint* normal)
+{
+    *position = shdNormal_position;
+    *projection = shdNormal_projection;
+    *modelview = shdNormal_modelview;
+    *normal = shdNormal_normal;
+    esUseProgram(shdNormal);
 }
 
 // notice: swapped this from 3 to 2
@@ -870,7 +1580,7 @@ void shadeLambert2(GLint* position, GLint* projection, GLint* modelview, GLint*
     *lightpos = shdLambert3_lightpos;
     *color = shdLambert3_color;
     *opacity = shdLambert3_opacity;
-    glUseProgram(shdLambert3);
+    esUseProgram(shdLambert3);
 }
 
 void shadePhong(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* color, GLint* opacity)
@@ -882,7 +1592,7 @@ void shadePhong(GLint* position, GLint* projection, GLint* modelview, GLint* nor
     *lightpos = shdPhong_lightpos;
     *color = shdPhong_color;
     *opacity = shdPhong_opacity;
-    glUseProgram(shdPhong);
+    esUseProgram(shdPhong);
 }
 
 void shadePhong1(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity)
@@ -895,7 +1605,7 @@ void shadePhong1(GLint* position, GLint* projection, GLint* modelview, GLint* no
     *color = shdPhong1_color;
     *normal = shdPhong1_normal;
     *opacity = shdPhong1_opacity;
-    glUseProgram(shdPhong1);
+    esUseProgram(shdPhong1);
 }
 
 void shadePhong2(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* color, GLint* opacity)
@@ -907,7 +1617,7 @@ void shadePhong2(GLint* position, GLint* projection, GLint* modelview, GLint* no
     *lightpos = shdPhong2_lightpos;
     *color = shdPhong2_color;
     *opacity = shdPhong2_opacity;
-    glUseProgram(shdPhong2);
+    esUseProgram(shdPhong2);
 }
 
 void shadePhong3(GLint* position, GLint* projection, GLint* modelview, GLint* normalmat, GLint* lightpos, GLint* normal, GLint* color, GLint* opacity)
@@ -920,7 +1630,7 @@ void shadePhong3(GLint* position, GLint* projection, GLint* modelview, GLint* no
     *color = shdPhong3_color;
     *normal = shdPhong3_normal;
     *opacity = shdPhong3_opacity;
-    glUseProgram(shdPhong3);
+    esUseProgram(shdPhong3);
 }
 
 #endif
@@ -0,0 +1,127 @@
+/*
+    Space Miner with no window and no GL, runs the simulation in sim.h
+    from a seed for N steps of a scripted flight and reports the time per
+    step, so the game logic can be profiled and checked on build servers.
+
+    The flight thrusts forward the whole time, turns every few seconds,
+    and tries to break, repel and stop rocks at fixed intervals.
+
+    Compile: gcc headless.c -Ofast -lm -lpthread -o headless
+    Usage:   ./headless [seed] [steps] [threads] [--rocks=n] [--far=d] [--stream] [--simd=0] [--config=file]
+*/
+
+#include <stdint.h>
+#include "sim.h"
+
+world w;
+input inp;
+
+#define COLOR_CHUNK 4096 // colours are hashed a chunk of rocks at a time, all of them would be 2.8 KB a rock
+f32 colors[COLOR_CHUNK*720];
+
+static double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t fnv(uint64_t h, const void* data, size_t len)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for(size_t i = 0; i < len; i++)
+        h = (h ^ p[i]) * 1099511628211ULL;
+    return h;
+}
+
+// fnv-1a over the rock positions & player state, two runs agree only if the worlds do
+uint64_t worldHash(const world* w)
+{
+    uint64_t h = fnv(14695981039346656037ULL, &w->rocks.pos[0], ARRAY_MAX*sizeof(vec));
+    const f32 pl[5] = {w->pp.x, w->pp.y, w->pp.z, w->pf, (f32)w->pm};
+    return fnv(h, &pl[0], sizeof(pl));
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int seed = NEWGAME_SEED;
+    unsigned int steps = 36000;
+    unsigned int threads = 0;
+    unsigned int pos = 0;
+    for(int i = 1; i < argc; i++)
+    {
+        if(strncmp(argv[i], "--config=", 9) == 0)
+        {
+            if(sim_config(&argv[i][9], sim_option) == 0)
+                printf("Could not read config: %s\n", &argv[i][9]);
+        }
+        else if(strncmp(argv[i], "--", 2) == 0)
+        {
+            if(sim_option(&argv[i][2]) == 0)
+                printf("Unknown option: %s\n", argv[i]);
+        }
+        else if(pos == 0){seed = atoi(argv[i]); pos++;}
+        else if(pos == 1){steps = atoi(argv[i]); pos++;}
+        else if(pos == 2){threads = atoi(argv[i]); pos++;}
+    }
+    if(sim_init(&w) == 0)
+    {
+        printf("Out of memory for %u rocks.\n", ARRAY_MAX);
+        return 1;
+    }
+    poolInit(threads);
+
+    double st = now();
+    sim_new(&w, seed);
+    uint64_t gh = worldHash(&w);
+    for(unsigned int i = 0; i < ARRAY_MAX; i += COLOR_CHUNK)
+    {
+        const unsigned int n = ARRAY_MAX-i < COLOR_CHUNK ? ARRAY_MAX-i : COLOR_CHUNK;
+        sim_colors(&w, i, n, &colors[0]);
+        gh = fnv(gh, &colors[0], n*720*sizeof(f32));
+    }
+    const double gt = now() - st;
+
+    inp.keys[2] = 1;
+    double tt = 0.0;
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        inp.keys[0] = (i % 600) < 30; // turn left half a second every ten
+        inp.xrot = w.pr;
+
+        st = now();
+        sim_step(&w, &inp, SIM_DT);
+        if(i % 30 == 0){sim_break(&w);}
+        if(i % 120 == 60){sim_repel(&w);}
+        if(i % 600 == 300){sim_stop(&w);}
+        tt += now() - st;
+
+        w.mined_num = 0; // no renderer to take them
+        w.loaded_num = 0;
+        w.stirred_num = 0;
+    }
+
+    char strts[16];
+    timestamp(&strts[0]);
+    printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, w.pf, w.pb, w.ps, w.psl, w.pre, w.pm);
+    printf("seed:     %u\n", seed);
+    printf("rocks:    %u\n", ARRAY_MAX);
+    printf("far:      %g\n", FAR_DISTANCE);
+    printf("sectors:  %u of %u rocks, player in %i %i %i\n", w.sectors, w.sector_rocks, w.scx, w.scy, w.scz);
+    unsigned int sleeping = 0;
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        sleeping += w.rocks.sleep[i] != 0;
+    printf("active:   %u, %u asleep\n", w.active_num, sleeping);
+    printf("memory:   %.1f MB\n", sim_bytes()/1048576.0);
+    printf("threads:  %u\n", poolThreads());
+    printf("cpu:      %s\n", cpuName());
+    printf("kernel:   %s\n", step_kernel);
+    printf("generate: %.2f ms\n", gt*1e3);
+    printf("genhash:  %016llx\n", (unsigned long long)gh);
+    printf("steps:    %u\n", steps);
+    printf("step:     %.0f ns\n", tt*1e9/steps);
+    printf("hash:     %016llx\n", (unsigned long long)worldHash(&w));
+    poolQuit();
+    sim_free(&w);
+    return 0;
+}
@@ -9,7 +9,7 @@
 
     Keyboard:
 
-        F = FPS to console
+        F = FPS, frame time & input latency percentiles to console
         P = Player stats to console
         N = New Game
         Q = Break Asteroid
@@ -31,6 +31,25 @@
         Scroll = Zoom in/out
 
 
+    Command Line:
+
+        [msaa]      = MSAA level 0-16 (default 16)
+        --instanced = draw the asteroids with instancing (GL 3.3 or ARB_instanced_arrays)
+        --nolod     = draw every asteroid with its full mesh
+        --noimpostor = draw the farthest asteroids with meshes instead of point sprites
+        --bench[=n] = fly a scripted path for n frames (default 3600) without vsync & print timings
+        --rocks=n   = asteroid count (default 16384, 2048 on ARM)
+        --far=d     = asteroids start within +/- d on each axis (default keeps the density of 16384)
+        --color_radius=d = distance asteroids show their minerals from (default 333)
+        --stream    = generate the asteroids in sectors around the player as they fly, an endless field
+        --config=file = read any of the above from key=value lines, # comments
+
+    Offscreen builds (-DOFFSCREEN, see offscreen.h) also take:
+
+        --frames=n  = frames to render before exiting (default 600, or the --bench length)
+        --ppm=n     = write every n-th frame to frame_NNNNN.ppm
+
+
     Notes:
 
         Frustum Culling:
@@ -63,12 +82,18 @@
 #include "gl.h"
 #define GLFW_INCLUDE_NONE
 #include "glfw3.h"
+#ifdef OFFSCREEN
+    #include "offscreen.h"
+#endif
 
 #ifndef __x86_64__ 
     #define NOSSE
 #endif
 #define SEIR_RAND
 #include "esAux2.h"
+#include "sim.h"
+#include "snapshot.h"
+#include "tel.h"
 
 #include "res.h"
 #include "assets/rock1.h"
@@ -80,6 +105,15 @@
 #include "assets/rock7.h"
 #include "assets/rock8.h"
 #include "assets/rock9.h"
+#include "assets/rock1_lod.h"
+#include "assets/rock2_lod.h"
+#include "assets/rock3_lod.h"
+#include "assets/rock4_lod.h"
+#include "assets/rock5_lod.h"
+#include "assets/rock6_lod.h"
+#include "assets/rock7_lod.h"
+#include "assets/rock8_lod.h"
+#include "assets/rock9_lod.h"
 #include "assets/face.h"
 #include "assets/body.h"
 #include "assets/arms.h"
@@ -101,6 +135,7 @@ uint winw = 1024;
 uint winh = 768;
 double t = 0;   // time
 f32 dt = 0;     // delta time
+f32 alpha = 0;  // render time between the last two sim steps, 0-1
 double fc = 0;  // frame count
 double lfct = 0;// last frame count time
 f32 aspect;
@@ -117,6 +152,14 @@ GLint solidcolor_id;
 GLint color_id;
 GLint opacity_id;
 GLint normal_id;
+GLint offset_id;
+GLint spin_id;
+GLint time_id;
+GLint part_id;
+GLint nearcol_id;
+GLint centre_id;
+GLint nearpos_id;
+GLint nearradius_id;
 
 // render state matrices
 mat projection;
@@ -130,79 +173,142 @@ vec lightpos = {0.f, 0.f, 0.f};
 // models
 sint bindstate = -1;
 sint bindstate2 = -1;
-uint keystate[6] = {0};
 ESModel mdlRock[9];
-ESModel mdlFace;
-ESModel mdlBody;
-ESModel mdlArms;
-ESModel mdlLeftFlame;
-ESModel mdlRightFlame;
-ESModel mdlLegs;
-ESModel mdlFuel;
-ESModel mdlShield;
-ESModel mdlPbreak;
-ESModel mdlPshield;
-ESModel mdlPslow;
-ESModel mdlPrepel;
-
-// game vars
-#define NEWGAME_SEED 1337
-#define THRUST_POWER 0.03f
-#define NECK_ANGLE 0.6f
-#define ROCK_DARKNESS 0.412f
-#define MAX_ROCK_SCALE 12.f
-const f32 RECIP_MAX_ROCK_SCALE = 1.f/(MAX_ROCK_SCALE+10.f);
-#define FUEL_DRAIN_RATE 0.01f
-#define SHIELD_DRAIN_RATE 0.06f
-#define REFINARY_YEILD 0.13f
-
-#ifdef __arm__
-    #define ARRAY_MAX 2048 // 8 Megabytes of Asteroids
-    const f32 FAR_DISTANCE = (float)ARRAY_MAX / 4.f;
-#else
-    #define ARRAY_MAX 16384 // 64 Megabytes of Asteroids
-    f32 FAR_DISTANCE = (float)ARRAY_MAX / 8.f;
-#endif
+
+// rock colour arrays are made on the CPU for the rocks close enough to show
+// them and kept in GPU slots, a slot is reused once its rock goes unseen
+#define COLOR_SLOTS 4096        // 11 Megabytes of GPU colours
+GLuint rock_colors_id;
+f32 color_radius = 333.f;       // --color_radius
+unsigned int color_slots;       // COLOR_SLOTS, or the rock count if that is less
+int* color_slot;                // per rock, -1 = none
+unsigned int* slot_rock;        // per slot, ARRAY_MAX = none
+unsigned int* slot_frame;       // per slot, frame it was last drawn
+unsigned int slot_hand = 0;     // where the search for a reusable slot carries on from
+unsigned int slot_full = 0;     // frame the slots ran out in
+unsigned int color_frame = 1;
+
+// rock LODs, made offline by assets/lod.c, 0 is the full mesh
+#define ROCK_LODS 3
+#define LOD_HYSTERESIS 0.1f     // a rock has to pass a switch distance by 10% before it changes LOD
+#define ROCK_IMPOSTOR ROCK_LODS // rock_lod of a rock drawn as a point sprite
+const f32 lod_dist[ROCK_IMPOSTOR] = {60.f, 160.f, 320.f}; // distance per unit of rock scale where LOD 1, 2 & impostors start
+ESModel mdlRockLod[ROCK_LODS-1][9];
+GLsizei rock_numind[ROCK_LODS][9];
+unsigned char* rock_lod;        // LOD each rock was last drawn with
+uint nolod = 0;                 // --nolod
+unsigned long long rock_tris = 0; // rock triangles submitted, for the benchmark
+
+// impostors, the farthest rocks are one point sprite each lit from an
+// atlas of baked normals, a row per rock mesh & a column per angle
+#define IMP_ANGLES 8
+#define IMP_CELL 32             // atlas cell size in pixels
+#define IMP_RADIUS 1.3f         // every rock mesh fits inside this
+uint impostors = 1;             // --noimpostor, also off without framebuffer objects
+GLuint imp_tex;
+GLuint imp_vbo;
+f32* imp_data;                  // rockInstance() layout with the mesh in the last float
+uint imp_num = 0;
+unsigned long long imp_total = 0; // impostors drawn, for the benchmark
+GLint pointscale_id;
+GLint atlas_id;
+GLint sampler_id;
+
+// astronaut, every part merged into one mesh with a part id per vertex,
+// the shield elipse last so it can be drawn on its own with blending
+enum {PART_LEGS, PART_BODY, PART_FUEL, PART_ARMS, PART_LEFT_FLAME, PART_RIGHT_FLAME, PART_FACE, PART_BREAK, PART_SHIELD, PART_SLOW, PART_REPEL, PART_ELIPSE, PARTS};
+ESModel mdlPlayer;
+GLsizei player_numind;          // indices of every part but the shield elipse
+mat part_mv[PARTS];             // per part modelview
+f32 part_color[PARTS*4];        // per part rgb + opacity
+
+// instanced asteroids
+uint instanced = 0;             // --instanced, one draw per rock mesh instead of one per rock
+GLuint inst_vbo;                // per-instance stream
+f32* inst_data[ROCK_LODS];      // offset (x,y,z,scale) + spin (selector,angle,0,0), per LOD
+unsigned int inst_num[ROCK_LODS];
+unsigned int inst_count[ROCK_LODS][9]; // instances per rock mesh, rock meshes are contiguous ranges of each LOD
+unsigned int* inst_near;        // staged rocks that still need their unique colour array
+unsigned int inst_near_num = 0;
+
+// per snapshot rock, staged on the pool.h workers in runs of STEP_RUN so
+// the GL thread only picks slots & submits
+#define STAGE_ASLEEP 255        // stage_lod of a sleeping rock, its chunk draws it
+f32* stage_data;                // rockInstance() layout, in snapshot order
+f32* stage_dist;                // to the player
+unsigned char* stage_lod;       // rockLod()
+
+// stopped asteroids, sim.h puts them to sleep and they are baked in world
+// space into one vertex buffer per chunk of space, a chunk is only rebuilt
+// when a rock in it falls asleep or wakes, so a stopped region is a few draws
+#define CHUNK_SIZE 128.f
 typedef struct
 {
-    // since we have the room
-    int free; // fast free checking
-    int nores;// no mineral resources
-
-    // rock vars
-    f32 scale;
-    vec pos;
-    vec vel;
-
-    // +6 bytes
-    uint rnd;
-    f32 rndf;
-
-    // rock colour array
-    f32 colors[720];
-    
-    // mineral amounts
-    f32 qshield;
-    f32 qbreak;
-    f32 qslow;
-    f32 qrepel;
-    f32 qfuel;
-
-} gi; // 4+4+4+16+16+2+4+2880+4+4+4+4+4 = 2950 bytes = 4096 padded (4 kilobyte)
-gi array_rocks[ARRAY_MAX] = {0};
-
-// gets a free/unused rock
-/*
-// the original idea was to dynamically pop out ores when rocks are mined
-// which then you need to manually float to and collect but, I went off the idea.
-sint freeRock() 
+    unsigned int i;
+    unsigned int flag;          // SNAP_NORES
+    vec p;                      // where it sleeps, its scale in w
+} sleeper;
+typedef struct
 {
-    for(sint i = 0; i < ARRAY_MAX; i++)
-        if(array_rocks[i].free == 1)
-            return i;
-    return -1;
-}
-*/
+    int x, y, z;
+    sleeper* rocks;
+    unsigned int num, max;
+    ESModel mdl;                // world space vertices, normals & far colours
+    GLuint near_cid;            // the rocks' own colours, drawn inside the colour radius
+    GLuint centre;              // per vertex, its rock's centre for the colour radius test
+    GLsizei verts;              // 0 = nothing baked
+    uint dirty;
+} chunk;
+chunk* chunks;
+unsigned int chunk_num = 0, chunk_max = 0;
+int* rock_chunk;                // per rock, -1 = awake
+f32* chunk_bake;                // scratch for bakeChunk()
+size_t chunk_bake_max = 0;
+unsigned long long chunk_total = 0; // chunks drawn, for the benchmark
+const GLfloat* rock_verts[9] = {rock1_vertices, rock2_vertices, rock3_vertices, rock4_vertices, rock5_vertices, rock6_vertices, rock7_vertices, rock8_vertices, rock9_vertices};
+const GLfloat* rock_norms[9] = {rock1_normals, rock2_normals, rock3_normals, rock4_normals, rock5_normals, rock6_normals, rock7_normals, rock8_normals, rock9_normals};
+const GLushort* rock_inds[9] = {rock1_indices, rock2_indices, rock3_indices, rock4_indices, rock5_indices, rock6_indices, rock7_indices, rock8_indices, rock9_indices};
+
+// the sim steps on its own thread and hands the renderer snapshots through
+// snapshot.h, the benchmark & simthread=0 step on the render thread instead
+uint simthread = 1;             // simthread=0
+pthread_t sim_thread;
+pool stage_pool;                // the render thread's workers while the sim has its own
+input sim_inp;                  // the input the sim steps with, sim thread
+double sim_acc = 0;             // step time carried over, sim thread
+unsigned int sim_quit = 0;
+
+// input reaches the sim as commands on a ring, stamped with when they happened,
+// the render thread pushes them and the sim takes them in order before the step
+// they fall in, so every input is acted on within one step of happening
+enum {CMD_BREAK, CMD_REPEL, CMD_STOP, CMD_KEY, CMD_YAW, CMD_NEWGAME};
+typedef struct
+{
+    double t;                   // glfwGetTime() when it happened
+    unsigned int u;             // CMD_KEY key<<1 | down, CMD_NEWGAME seed
+    f32 f;                      // CMD_YAW camera yaw
+    unsigned char kind;
+} command;
+#define CMD_QUEUE 4096
+command cmd_ring[CMD_QUEUE];
+unsigned long long cmd_head = 0; // pushed, render thread
+unsigned long long cmd_tail = 0; // taken, sim thread
+unsigned long long cmd_shown = 0; // acted on in a drawn snapshot, render thread, slots before it are free
+uint cmd_keys[6];               // thrust keys as last pushed, render thread
+
+// key & button presses that ask for the same player action
+typedef struct
+{
+    int key, button;
+    uint cmd;
+} binding;
+const binding bindings[] = {{GLFW_KEY_Q, GLFW_MOUSE_BUTTON_LEFT, CMD_BREAK}, {GLFW_KEY_R, GLFW_MOUSE_BUTTON_RIGHT, CMD_REPEL}, {GLFW_KEY_E, GLFW_MOUSE_BUTTON_4, CMD_STOP}};
+const int thrust_keys[6] = {GLFW_KEY_A, GLFW_KEY_D, GLFW_KEY_W, GLFW_KEY_S, GLFW_KEY_LEFT_SHIFT, GLFW_KEY_SPACE}; // input.keys order
+
+// benchmark
+#define BENCH_FRAMES 3600       // a minute of game time
+GLuint bench = 0;               // --bench[=frames], frames to render
+GLuint bench_frame = 0;
 
 // camera vars
 uint focus_cursor = 1;
@@ -211,55 +317,17 @@ f32 xrot = 0.f;
 f32 yrot = 0.f;
 f32 zoom = -25.f;
 
-// player vars
-f32 so; // shield on (closest distance)
-uint ct;// thrust signal
-f32 pr; // rotation
-vec pp; // position
-vec pv; // velocity
-vec pd; // thust direction
-f32 lgr = 0.f; // last good head rotation
-vec pld;// look direction
-vec pfd;// face direction
-f32 pf; // fuel
-f32 pb; // break
-f32 ps; // shield
-f32 psp;// speed
-f32 psl;// slow
-f32 pre;// repel
+// game state
+world w;
+input inp;
+const snapshot* snap;   // what is drawn, snapTake() each frame
 uint lf;// last fuel
-uint pm;// mined asteroid count
 double st=0; // start time
 char tts[32];// time taken string
 
 //*************************************
 // utility functions
 //*************************************
-void timestamp(char* ts)
-{
-    const time_t tt = time(0);
-    strftime(ts, 16, "%H:%M:%S", localtime(&tt));
-}
-
-static inline f32 fzero(f32 f)
-{
-    if(f < 0.f){f = 0.f;}
-    return f;
-}
-
-static inline f32 fone(f32 f)
-{
-    if(f > 1.f){f = 1.f;}
-    return f;
-}
-
-static inline f32 fsat(f32 f)
-{
-    if(f < 0.f){f = 0.f;}
-    if(f > 1.f){f = 1.f;}
-    return f;
-}
-
 void timeTaken(uint ss)
 {
     if(ss == 1)
@@ -291,791 +359,906 @@ void timeTaken(uint ss)
 //*************************************
 // render functions
 //*************************************
-void rRock(uint i, f32 dist)
+static inline vec lerpv(const vec a, const vec b)
 {
-    static const uint rcs = ARRAY_MAX / 9;
-    static const f32 rrcs = 1.f / (f32)rcs;
-
-    mIdent(&model);
-    mTranslate(&model, array_rocks[i].pos.x, array_rocks[i].pos.y, array_rocks[i].pos.z);
-
-    if(array_rocks[i].rnd < 500)
-    {
-        f32 mag = vMag(array_rocks[i].vel)*array_rocks[i].rndf*t;
-        if(array_rocks[i].rnd < 100)
-            mRotY(&model, mag);
-        if(array_rocks[i].rnd < 200)
-            mRotZ(&model, mag);
-        if(array_rocks[i].rnd < 300)
-            mRotX(&model, mag);
-    }
-
-    if(array_rocks[i].free == 2)
-    {
-        array_rocks[i].scale -= 32.f*dt;
-        if(array_rocks[i].scale <= 0.f)
-            array_rocks[i].free = 1;
-        mScale(&model, array_rocks[i].scale, array_rocks[i].scale, array_rocks[i].scale);
-    }
-    else
-        mScale(&model, array_rocks[i].scale, array_rocks[i].scale, array_rocks[i].scale);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-
-    // unique colour arrays for each rock within visible distance
-    if(array_rocks[i].nores == 0 && dist < 333.f)
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, mdlRock[0].cid);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(rock1_colors), array_rocks[i].colors, GL_STATIC_DRAW);
-        glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-        glEnableVertexAttribArray(color_id);
-        bindstate2 = 0;
-    }
-    else
-    {
-        if(bindstate2 != 1)
-        {
-            glBindBuffer(GL_ARRAY_BUFFER, mdlRock[1].cid);
-            glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-            glEnableVertexAttribArray(color_id);
-            bindstate2 = 1;
-        }
-    }
-
-    // this is a super efficient way to render 9 different types of asteroid
-    uint nbs = i * rrcs;
-    if(nbs > 8){nbs = 8;}
-    if(nbs != bindstate)
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, mdlRock[nbs].vid);
-        glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-        glEnableVertexAttribArray(position_id);
-
-        glBindBuffer(GL_ARRAY_BUFFER, mdlRock[nbs].nid);
-        glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-        glEnableVertexAttribArray(normal_id);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlRock[nbs].iid);
-        bindstate = nbs;
-    }
-
-    glDrawElements(GL_TRIANGLES, rock1_numind, GL_UNSIGNED_SHORT, 0);
+    return (vec){a.x + (b.x-a.x)*alpha, a.y + (b.y-a.y)*alpha, a.z + (b.z-a.z)*alpha, 0.f};
 }
 
-void rLegs(f32 x, f32 y, f32 z, f32 rx)
+// a snapshot rock (SNAP_FLOATS) interpolated into offset & spin
+static inline void rockInstance(const f32* r, f32* d)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-    f32 mag = psp*32.f;
-    if(mag > 0.4f)
-        mag = 0.4f;
-    mRotY(&model, mag);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, 1.f, 1.f, 1.f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlLegs.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlLegs.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlLegs.iid);
-
-    glDrawElements(GL_TRIANGLES, legs_numind, GL_UNSIGNED_SHORT, 0);
+    const vec p = lerpv((vec){r[0], r[1], r[2], 0.f}, (vec){r[3], r[4], r[5], 0.f});
+    d[0] = p.x;
+    d[1] = p.y;
+    d[2] = p.z;
+    d[3] = r[6];
+    d[4] = r[7];
+    d[5] = r[8];
+    d[6] = r[9];
+    d[7] = 0.f;
 }
 
-void rBody(f32 x, f32 y, f32 z, f32 rx)
+static inline ESModel* rockModel(uint mesh, uint lod)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-
-    // returns new player direction
-    mGetDirZ(&pld, model);
-    vInv(&pld);
-    if(ct > 0)
-    {
-        mGetDirZ(&pd, model);
-        vInv(&pd);
-        ct = 0;
-    }
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, 1.f, 1.f, 1.f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlBody.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlBody.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlBody.iid);
-
-    glDrawElements(GL_TRIANGLES, body_numind, GL_UNSIGNED_SHORT, 0);
+    return lod == 0 ? &mdlRock[mesh] : &mdlRockLod[lod-1][mesh];
 }
 
-void rFuel(f32 x, f32 y, f32 z, f32 rx)
+// this is a super efficient way to render 9 different types of asteroid,
+// each mesh is a ninth of every sector's rocks in index order
+static inline uint rockMesh(unsigned int i)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, fone(0.062f+(1.f-pf)), fone(1.f+(1.f-pf)), fone(0.873f+(1.f-pf)));
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlFuel.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlFuel.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlFuel.iid);
-
-    glDrawElements(GL_TRIANGLES, fuel_numind, GL_UNSIGNED_SHORT, 0);
+    const unsigned int m = (i % w.sector_rocks) / (w.sector_rocks / 9);
+    return m > 8 ? 8 : m;
 }
 
-void rArms(f32 x, f32 y, f32 z, f32 rx)
+// rocks showing their minerals, flag is the snapshot's
+static inline int rockNear(unsigned int flag, f32 dist)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-
-    f32 mag = psp*32.f;
-    if(mag > 0.4f)
-        mag = 0.4f;
-    mRotY(&model, mag);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, 1.f, 1.f, 1.f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlArms.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlArms.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlArms.iid);
-
-    glDrawElements(GL_TRIANGLES, arms_numind, GL_UNSIGNED_SHORT, 0);
+    return (flag & SNAP_NORES) == 0 && dist < color_radius;
 }
 
-void rLeftFlame(f32 x, f32 y, f32 z, f32 rx)
+// a rock's colour array from the snapshot's sector keys & its flag, never the world
+static inline void rockColors(unsigned int i, unsigned int flag, f32* colors)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-
-    f32 mag = psp*32.f;
-    if(mag > 0.4f)
-        mag = 0.4f;
-    mRotY(&model, mag);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    //glUniform3f(color_id, 1.f, 0.f, 0.f);
-    glUniform3f(color_id, 0.062f, 1.f, 0.873f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlLeftFlame.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlLeftFlame.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlLeftFlame.iid);
-
-    glDrawElements(GL_TRIANGLES, left_flame_numind, GL_UNSIGNED_SHORT, 0);
+    sim_key_colors(snap->key[i / w.sector_rocks], i % w.sector_rocks, (flag & SNAP_SPENT) != 0, colors);
 }
 
-void rRightFlame(f32 x, f32 y, f32 z, f32 rx)
+// GPU slot holding a rock's colour array, made on first use, -1 when every
+// slot is taken this frame and the rock has to make do with the far colours
+static inline int rockColorSlot(unsigned int i, unsigned int flag)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -rx);
-
-    f32 mag = psp*32.f;
-    if(mag > 0.4f)
-        mag = 0.4f;
-    mRotY(&model, mag);
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, 0.062f, 1.f, 0.873f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlRightFlame.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlRightFlame.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlRightFlame.iid);
-
-    glDrawElements(GL_TRIANGLES, right_flame_numind, GL_UNSIGNED_SHORT, 0);
+    int s = color_slot[i];
+    if(s < 0)
+    {
+        if(slot_full == color_frame)
+            return -1;
+        unsigned int k = 0;
+        while(slot_frame[slot_hand] == color_frame)
+        {
+            slot_hand = (slot_hand+1) % color_slots;
+            if(++k == color_slots)
+            {
+                slot_full = color_frame;
+                return -1;
+            }
+        }
+        s = slot_hand;
+        slot_hand = (slot_hand+1) % color_slots;
+        if(slot_rock[s] < ARRAY_MAX)
+            color_slot[slot_rock[s]] = -1;
+        slot_rock[s] = i;
+        color_slot[i] = s;
+
+        f32 colors[720];
+        rockColors(i, flag, &colors[0]);
+        esBindBuffer(GL_ARRAY_BUFFER, rock_colors_id);
+        glBufferSubData(GL_ARRAY_BUFFER, s*sizeof(rock1_colors), sizeof(rock1_colors), &colors[0]);
+    }
+    slot_frame[s] = color_frame;
+    return s;
 }
 
-void rFace(f32 x, f32 y, f32 z, f32 rx)
+// picks a LOD on distance over scale, a rock only changes LOD once it is
+// LOD_HYSTERESIS past the switch distance so it can't flicker on the line,
+// rocks showing their unique colours always get the full mesh
+static inline uint rockLod(unsigned int i, unsigned int flag, f32 s, f32 dist)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -xrot);
-
-    mGetDirZ(&pfd, model);
-    vInv(&pfd);
-    const f32 dot = vDot(pfd, pld);
-    if(dot < NECK_ANGLE)
+    if(nolod == 1 || rockNear(flag, dist) == 1)
     {
-        mIdent(&model);
-        mTranslate(&model, x, y, z);
-        mRotX(&model, -lgr);
+        rock_lod[i] = 0;
+        return 0;
     }
-    else
+    const uint top = impostors == 1 ? ROCK_IMPOSTOR : ROCK_LODS-1;
+    uint l = rock_lod[i];
+    if(l > top){l = top;}
+    while(l < top && dist > lod_dist[l]*(1.f+LOD_HYSTERESIS)*s)
+        l++;
+    while(l > 0 && dist < lod_dist[l-1]*(1.f-LOD_HYSTERESIS)*s)
+        l--;
+    rock_lod[i] = l;
+    return l;
+}
+
+// interpolated instance, distance & LOD of snapshot rocks start to end, every
+// rock writes only its own stage & rock_lod entries so runs can go on any thread
+static void stageRocks(void* arg, unsigned int start, unsigned int end)
+{
+    const vec pp = *(const vec*)arg;
+    for(unsigned int c = start; c < end; c++)
     {
-        lgr = xrot;
+        const unsigned int last = (c+1)*STEP_RUN < snap->num ? (c+1)*STEP_RUN : snap->num;
+        for(unsigned int k = c*STEP_RUN; k < last; k++)
+        {
+            if((snap->flag[k] & SNAP_ASLEEP) != 0)
+            {
+                stage_lod[k] = STAGE_ASLEEP; // stopped, uStirred() put it in its chunk
+                continue;
+            }
+            f32* d = &stage_data[k*8];
+            rockInstance(&snap->rock[k*SNAP_FLOATS], d);
+            stage_dist[k] = vDist(pp, (vec){d[0], d[1], d[2], 0.f});
+            stage_lod[k] = rockLod(snap->id[k], snap->flag[k], d[3], stage_dist[k]);
+        }
     }
+}
 
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, 1.f, 1.f, 1.f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlFace.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlFace.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlFace.iid);
-
-    glDrawElements(GL_TRIANGLES, face_numind, GL_UNSIGNED_SHORT, 0);
+// queues a staged rock for rImpostors()
+static inline void iImpostor(const f32* d, uint mesh)
+{
+    f32* o = &imp_data[imp_num*8];
+    memcpy(o, d, 7*sizeof(f32));
+    o[7] = (f32)mesh;
+    imp_num++;
 }
 
-void rBreak(f32 x, f32 y, f32 z, f32 rx)
+// the model matrix (translate, spin, scale) is built by the shader from
+// constant offset & spin attributes, modelview_id only holds the view
+void rRock(unsigned int k)
 {
-    bindstate = -1;
+    const unsigned int i = snap->id[k];
+    const f32* d = &stage_data[k*8];
+    const uint lod = stage_lod[k];
+    const uint nbs = rockMesh(i);
+    if(lod == ROCK_IMPOSTOR)
+    {
+        iImpostor(d, nbs);
+        return;
+    }
 
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -xrot);
+    glVertexAttrib4fv(offset_id, &d[0]);
+    glVertexAttrib4fv(spin_id, &d[4]);
 
-    vec dir;
-    mGetDirZ(&dir, model);
-    vInv(&dir);
-    const f32 dot = vDot(dir, pld);
-    if(dot < NECK_ANGLE)
+    if(nbs + lod*9 != bindstate)
     {
-        mIdent(&model);
-        mTranslate(&model, x, y, z);
-        mRotX(&model, -lgr);
+        esUseModel(rockModel(nbs, lod));
+        bindstate = nbs + lod*9;
+        bindstate2 = lod == 0 ? -1 : 2; // the model's own colours are bound now, LODs keep theirs
+    }
+
+    // unique colour arrays for each rock within visible distance
+    const int slot = rockNear(snap->flag[k], stage_dist[k]) == 1 ? rockColorSlot(i, snap->flag[k]) : -1;
+    if(slot >= 0)
+    {
+        esBindBuffer(GL_ARRAY_BUFFER, rock_colors_id);
+        glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, (void*)(size_t)(slot*sizeof(rock1_colors)));
+        glEnableVertexAttribArray(color_id);
+        bindstate2 = 0;
     }
     else
     {
-        lgr = xrot;
+        if(bindstate2 != 1 && bindstate2 != 2)
+        {
+            esBindBuffer(GL_ARRAY_BUFFER, mdlRock[1].cid);
+            glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+            glEnableVertexAttribArray(color_id);
+            bindstate2 = 1;
+        }
     }
 
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, fone(0.644f+(1.f-pb)), fone(0.209f+(1.f-pb)), fone(0.f+(1.f-pb)));
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPbreak.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPbreak.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlPbreak.iid);
-
-    glDrawElements(GL_TRIANGLES, pbreak_numind, GL_UNSIGNED_SHORT, 0);
+    glDrawElements(GL_TRIANGLES, rock_numind[lod][nbs], GL_UNSIGNED_SHORT, 0);
+    rock_tris += rock_numind[lod][nbs] / 3;
 }
 
-void rShield(f32 x, f32 y, f32 z, f32 rx)
+// queues a staged rock for rRocksInstanced(), same rules as rRock()
+void iRock(unsigned int k)
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -xrot);
-
-    vec dir;
-    mGetDirZ(&dir, model);
-    vInv(&dir);
-    const f32 dot = vDot(dir, pld);
-    if(dot < NECK_ANGLE)
+    // unique colour arrays for each rock within visible distance
+    if(rockNear(snap->flag[k], stage_dist[k]) == 1)
     {
-        mIdent(&model);
-        mTranslate(&model, x, y, z);
-        mRotX(&model, -lgr);
+        inst_near[inst_near_num++] = k;
+        return;
     }
-    else
+
+    const f32* d = &stage_data[k*8];
+    const uint lod = stage_lod[k];
+    const uint nbs = rockMesh(snap->id[k]);
+    if(lod == ROCK_IMPOSTOR)
     {
-        lgr = xrot;
+        iImpostor(d, nbs);
+        return;
     }
-
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, fone(0.f+(1.f-ps)), fone(0.8f+(1.f-ps)), fone(0.28f+(1.f-ps)));
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPshield.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPshield.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlPshield.iid);
-
-    glDrawElements(GL_TRIANGLES, pshield_numind, GL_UNSIGNED_SHORT, 0);
+    memcpy(&inst_data[lod][inst_num[lod]*8], d, 8*sizeof(f32));
+    inst_count[lod][nbs]++;
+    inst_num[lod]++;
 }
 
-void rSlow(f32 x, f32 y, f32 z, f32 rx)
+// draws everything queued by iRock(), one instanced draw per rock mesh
+void rRocksInstanced()
 {
-    bindstate = -1;
-
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -xrot);
+    const GLsizei stride = 8*sizeof(f32);
 
-    vec dir;
-    mGetDirZ(&dir, model);
-    vInv(&dir);
-    const f32 dot = vDot(dir, pld);
-    if(dot < NECK_ANGLE)
+    // each LOD's instances packed one after the other
+    esBindBuffer(GL_ARRAY_BUFFER, inst_vbo);
+    glBufferData(GL_ARRAY_BUFFER, ARRAY_MAX*stride, NULL, GL_STREAM_DRAW);
+    unsigned int first = 0;
+    for(uint l = 0; l < ROCK_LODS; l++)
     {
-        mIdent(&model);
-        mTranslate(&model, x, y, z);
-        mRotX(&model, -lgr);
+        glBufferSubData(GL_ARRAY_BUFFER, first*stride, inst_num[l]*stride, &inst_data[l][0]);
+        first += inst_num[l];
     }
-    else
-    {
-        lgr = xrot;
-    }
-
-    mMul(&modelview, &model, &view);
 
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, fone(0.429f+(1.f-psl)), fone(0.f+(1.f-psl)), fone(0.8f+(1.f-psl)));
+    // instance arrays & divisors are VAO state, so they are set up and torn down per mesh
+    first = 0;
+    for(uint k = 0; k < ROCK_LODS*9; k++)
+    {
+        const uint l = k / 9, j = k % 9;
+        if(inst_count[l][j] == 0)
+            continue;
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPslow.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
+        esUseModel(rockModel(j, l));
+        if(l == 0)
+        {
+            esBindBuffer(GL_ARRAY_BUFFER, mdlRock[1].cid);
+            glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+            glEnableVertexAttribArray(color_id);
+        }
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPslow.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
+        esBindBuffer(GL_ARRAY_BUFFER, inst_vbo);
+        glVertexAttribPointer(offset_id, 4, GL_FLOAT, GL_FALSE, stride, (void*)(size_t)(first*stride));
+        glVertexAttribPointer(spin_id, 4, GL_FLOAT, GL_FALSE, stride, (void*)(size_t)(first*stride + 4*sizeof(f32)));
+        glEnableVertexAttribArray(offset_id);
+        glEnableVertexAttribArray(spin_id);
+        glVertexAttribDivisor(offset_id, 1);
+        glVertexAttribDivisor(spin_id, 1);
+
+        glDrawElementsInstanced(GL_TRIANGLES, rock_numind[l][j], GL_UNSIGNED_SHORT, 0, inst_count[l][j]);
+        rock_tris += (rock_numind[l][j] / 3) * inst_count[l][j];
+
+        // offset & spin go back to constant attributes for the near rocks & other shaders
+        glVertexAttribDivisor(offset_id, 0);
+        glVertexAttribDivisor(spin_id, 0);
+        glDisableVertexAttribArray(offset_id);
+        glDisableVertexAttribArray(spin_id);
+
+        first += inst_count[l][j];
+        inst_count[l][j] = 0;
+    }
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlPslow.iid);
+    // the few rocks close enough to show their minerals, offset & spin become constant attributes
+    for(unsigned int n = 0; n < inst_near_num; n++)
+    {
+        const unsigned int k = inst_near[n], i = snap->id[k];
+        const f32* d = &stage_data[k*8];
+        glVertexAttrib4fv(offset_id, &d[0]);
+        glVertexAttrib4fv(spin_id, &d[4]);
+        esUseModel(&mdlRock[rockMesh(i)]);
+
+        const int slot = rockColorSlot(i, snap->flag[k]);
+        esBindBuffer(GL_ARRAY_BUFFER, slot >= 0 ? rock_colors_id : mdlRock[1].cid);
+        glVertexAttribPointer(color_id, 3, GL_FLOAT, GL_FALSE, 0, (void*)(size_t)(slot >= 0 ? slot*sizeof(rock1_colors) : 0));
+        glEnableVertexAttribArray(color_id);
+        glDrawElements(GL_TRIANGLES, rock1_numind, GL_UNSIGNED_SHORT, 0);
+        rock_tris += rock1_numind / 3;
+    }
 
-    glDrawElements(GL_TRIANGLES, pslow_numind, GL_UNSIGNED_SHORT, 0);
+    for(uint l = 0; l < ROCK_LODS; l++)
+        inst_num[l] = 0;
+    inst_near_num = 0;
+    bindstate = -1;
+    bindstate2 = -1;
 }
 
-void rRepel(f32 x, f32 y, f32 z, f32 rx)
+// bakes a chunk's sleeping rocks in world space, a sleeping rock has no
+// spin (rndf = 0) so it is its mesh scaled & moved, always the full mesh
+static void bakeChunk(chunk* c)
 {
-    bindstate = -1;
+    c->dirty = 0;
+    c->verts = 0;
+    for(unsigned int k = 0; k < c->num; k++)
+        c->verts += rock_numind[0][rockMesh(c->rocks[k].i)];
+    if(c->verts == 0)
+        return;
+
+    const size_t n = (size_t)c->verts*3;
+    if(n*5 > chunk_bake_max)
+    {
+        f32* b = realloc(chunk_bake, n*5*sizeof(f32));
+        if(b == NULL)
+        {
+            c->verts = 0;
+            return;
+        }
+        chunk_bake = b;
+        chunk_bake_max = n*5;
+    }
+    f32* pos = chunk_bake;
+    f32* nrm = pos + n;
+    f32* fcol = nrm + n;
+    f32* ncol = fcol + n;
+    f32* cen = ncol + n;
 
-    mIdent(&model);
-    mTranslate(&model, x, y, z);
-    mRotX(&model, -xrot);
+    f32 colors[720];
+    for(unsigned int k = 0; k < c->num; k++)
+    {
+        const unsigned int i = c->rocks[k].i;
+        const uint m = rockMesh(i);
+        const vec p = c->rocks[k].p;
+        const f32 s = p.w;
+        const uint nores = (c->rocks[k].flag & SNAP_NORES) != 0;
+        if(nores == 0)
+            rockColors(i, c->rocks[k].flag, &colors[0]);
+        for(GLsizei j = 0; j < rock_numind[0][m]; j++)
+        {
+            const unsigned int v = rock_inds[m][j]*3;
+            pos[0] = rock_verts[m][v]*s + p.x;
+            pos[1] = rock_verts[m][v+1]*s + p.y;
+            pos[2] = rock_verts[m][v+2]*s + p.z;
+            memcpy(nrm, &rock_norms[m][v], 3*sizeof(f32));
+            memcpy(fcol, &rock2_colors[v], 3*sizeof(f32));
+            memcpy(ncol, nores == 0 ? &colors[v] : &rock2_colors[v], 3*sizeof(f32));
+            cen[0] = p.x;
+            cen[1] = p.y;
+            cen[2] = p.z;
+            pos += 3, nrm += 3, fcol += 3, ncol += 3, cen += 3;
+        }
+    }
 
-    vec dir;
-    mGetDirZ(&dir, model);
-    vInv(&dir);
-    const f32 dot = vDot(dir, pld);
-    if(dot < NECK_ANGLE)
+    if(c->mdl.vid == 0)
     {
-        mIdent(&model);
-        mTranslate(&model, x, y, z);
-        mRotX(&model, -lgr);
+        esBind(GL_ARRAY_BUFFER, &c->mdl.vid, NULL, 0, GL_DYNAMIC_DRAW);
+        esBind(GL_ARRAY_BUFFER, &c->mdl.nid, NULL, 0, GL_DYNAMIC_DRAW);
+        esBind(GL_ARRAY_BUFFER, &c->mdl.cid, NULL, 0, GL_DYNAMIC_DRAW);
+        esBind(GL_ARRAY_BUFFER, &c->near_cid, NULL, 0, GL_DYNAMIC_DRAW);
+        esBind(GL_ARRAY_BUFFER, &c->centre, NULL, 0, GL_DYNAMIC_DRAW);
+        esModelVAO(&c->mdl);
     }
-    else
+    const GLuint id[5] = {c->mdl.vid, c->mdl.nid, c->mdl.cid, c->near_cid, c->centre};
+    for(uint b = 0; b < 5; b++)
     {
-        lgr = xrot;
+        esBindBuffer(GL_ARRAY_BUFFER, id[b]);
+        glBufferData(GL_ARRAY_BUFFER, n*sizeof(f32), chunk_bake + b*n, GL_DYNAMIC_DRAW);
     }
+}
 
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, 1.0f);
-    glUniform3f(color_id, fone(0.095f+(1.f-pre)), fone(0.069f+(1.f-pre)), fone(0.041f+(1.f-pre)));
+// one draw per chunk with sleeping rocks, after the awake ones, the shader
+// gives each rock its own colours when its centre is inside the colour radius
+void rChunks(const vec pp)
+{
+    shadeLambert3N(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id, &nearcol_id, &centre_id, &nearpos_id, &nearradius_id);
+    esUniformMatrix4fv(projection_id, (f32*) &projection.m[0][0]);
+    esUniformMatrix4fv(modelview_id, (f32*) &view.m[0][0]);
+    esUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    esUniform1f(opacity_id, 1.0f);
+    esUniform3f(nearpos_id, pp.x, pp.y, pp.z);
+    esUniform1f(nearradius_id, color_radius);
+    for(unsigned int j = 0; j < chunk_num; j++)
+    {
+        chunk* c = &chunks[j];
+        if(c->dirty == 1)
+            bakeChunk(c);
+        if(c->verts == 0)
+            continue;
+
+        esUseModel(&c->mdl);
+        esBindBuffer(GL_ARRAY_BUFFER, c->near_cid);
+        glVertexAttribPointer(nearcol_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(nearcol_id);
+        esBindBuffer(GL_ARRAY_BUFFER, c->centre);
+        glVertexAttribPointer(centre_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+        glEnableVertexAttribArray(centre_id);
+        glDrawArrays(GL_TRIANGLES, 0, c->verts);
+        rock_tris += c->verts / 3;
+        chunk_total++;
+    }
+    glDisableVertexAttribArray(nearcol_id); // only this shader has them
+    glDisableVertexAttribArray(centre_id);
+    bindstate = -1;
+    bindstate2 = -1;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPrepel.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
+// draws everything queued by iImpostor() as one batch of point sprites
+void rImpostors()
+{
+    if(imp_num == 0)
+        return;
+    const GLsizei stride = 8*sizeof(f32);
+
+    shadeImpostor(&position_id, &projection_id, &modelview_id, &lightpos_id, &color_id, &spin_id, &time_id, &pointscale_id, &atlas_id, &sampler_id);
+    esUniformMatrix4fv(projection_id, (f32*) &projection.m[0][0]);
+    esUniformMatrix4fv(modelview_id, (f32*) &view.m[0][0]);
+    esUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    esUniform3f(color_id, rock2_colors[0], rock2_colors[1], rock2_colors[2]); // the far rocks' colour array
+    esUniform1f(time_id, t);
+    esUniform1f(pointscale_id, projection.m[1][1] * (f32)winh * IMP_RADIUS);
+    glUniform2f(atlas_id, 1.f/(f32)IMP_ANGLES, 1.f/9.f);
+    glUniform1i(sampler_id, 0);
+    glBindTexture(GL_TEXTURE_2D, imp_tex);
+
+    // position carries the offset here so attribute 0 is always an array
+    esBindVertexArray(0);
+    esBindBuffer(GL_ARRAY_BUFFER, imp_vbo);
+    glBufferData(GL_ARRAY_BUFFER, imp_num*stride, imp_data, GL_STREAM_DRAW);
+    glVertexAttribPointer(position_id, 4, GL_FLOAT, GL_FALSE, stride, 0);
+    glVertexAttribPointer(spin_id, 4, GL_FLOAT, GL_FALSE, stride, (void*)(size_t)(4*sizeof(f32)));
     glEnableVertexAttribArray(position_id);
+    glEnableVertexAttribArray(spin_id);
 
-    glBindBuffer(GL_ARRAY_BUFFER, mdlPrepel.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlPrepel.iid);
+    glDrawArrays(GL_POINTS, 0, imp_num);
 
-    glDrawElements(GL_TRIANGLES, prepel_numind, GL_UNSIGNED_SHORT, 0);
+    glDisableVertexAttribArray(position_id);
+    glDisableVertexAttribArray(spin_id);
+    imp_total += imp_num;
+    imp_num = 0;
+    bindstate = -1;
+    bindstate2 = -1;
 }
 
-void rShieldElipse(f32 x, f32 y, f32 z, f32 rx, f32 opacity)
+// the four rigid bodies the astronaut's parts hang off
+static inline void partMatrix(mat* r, f32 x, f32 y, f32 z, f32 rx, f32 ry)
 {
-    bindstate = -1;
-
     mIdent(&model);
     mTranslate(&model, x, y, z);
     mRotX(&model, -rx);
+    if(ry != 0.f)
+        mRotY(&model, ry);
+    mMul(r, &model, &view);
+}
 
-    mMul(&modelview, &model, &view);
-
-    glUniformMatrix4fv(modelview_id, 1, GL_FALSE, (f32*) &modelview.m[0][0]);
-    glUniform1f(opacity_id, opacity);
-    glUniform3f(color_id, 0.f, 0.717, 0.8f);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlShield.vid);
-    glVertexAttribPointer(position_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(position_id);
-
-    glBindBuffer(GL_ARRAY_BUFFER, mdlShield.nid);
-    glVertexAttribPointer(normal_id, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(normal_id);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mdlShield.iid);
-
-    glEnable(GL_BLEND);
-    glDrawElements(GL_TRIANGLES, shield_numind, GL_UNSIGNED_SHORT, 0);
-    glDisable(GL_BLEND);
+static inline void partColor(uint part, f32 r, f32 g, f32 b, f32 a)
+{
+    f32* c = &part_color[part*4];
+    c[0] = r, c[1] = g, c[2] = b, c[3] = a;
 }
 
+// every part in one draw, the shield elipse blends so it gets a second
 void rPlayer(f32 x, f32 y, f32 z, f32 rx)
 {
-    psp = vMag(pv);
+    bindstate = -1;
 
-    rLegs(x, y, z, rx);
-    rBody(x, y, z, rx);
-    rFuel(x, y, z, rx);
-    
-    rArms(x, y+2.6f, z, rx);
+    f32 mag = snap->psp*32.f;
+    if(mag > 0.4f)
+        mag = 0.4f;
 
+    mat legs, body, arms, head;
+    partMatrix(&legs, x, y, z, rx, mag);
+    partMatrix(&body, x, y, z, rx, 0.f);
+    partMatrix(&arms, x, y+2.6f, z, rx, mag);
+    partMatrix(&head, x, y+3.4f, z, snap->lgr, 0.f); // sim_step() has already turned the head to the camera or held it at the neck limit
+    part_mv[PART_LEGS] = legs;
+    part_mv[PART_BODY] = body;
+    part_mv[PART_FUEL] = body;
+    part_mv[PART_ARMS] = arms;
+    part_mv[PART_FACE] = head;
+    part_mv[PART_BREAK] = head;
+    part_mv[PART_SHIELD] = head;
+    part_mv[PART_SLOW] = head;
+    part_mv[PART_REPEL] = head;
+
+    // a flame that is off collapses to a point behind the camera
     uint lf=0, rf=0;
-    if(keystate[0] == 1)
+    if(inp.keys[0] == 1)
         rf = 1;
-    if(keystate[1] == 1)
+    if(inp.keys[1] == 1)
         lf = 1;
-    if(keystate[2] == 1)
+    if(inp.keys[2] == 1)
         rf = 1, lf = 1;
-    if(keystate[3] == 1)
+    if(inp.keys[3] == 1)
         rf = 1, lf = 1;
-    if(keystate[4] == 1)
+    if(inp.keys[4] == 1)
         rf = 1, lf = 1;
-    if(keystate[5] == 1)
+    if(inp.keys[5] == 1)
         rf = 1, lf = 1;
+    mat off = {0};
+    off.m[3][3] = 1.f;
+    part_mv[PART_LEFT_FLAME] = lf == 1 ? arms : off;
+    part_mv[PART_RIGHT_FLAME] = rf == 1 ? arms : off;
+
+    partColor(PART_FUEL, fone(0.062f+(1.f-snap->pf)), fone(1.f+(1.f-snap->pf)), fone(0.873f+(1.f-snap->pf)), 1.f);
+    partColor(PART_BREAK, fone(0.644f+(1.f-snap->pb)), fone(0.209f+(1.f-snap->pb)), fone(0.f+(1.f-snap->pb)), 1.f);
+    partColor(PART_SHIELD, fone(0.f+(1.f-snap->ps)), fone(0.8f+(1.f-snap->ps)), fone(0.28f+(1.f-snap->ps)), 1.f);
+    partColor(PART_SLOW, fone(0.429f+(1.f-snap->psl)), fone(0.f+(1.f-snap->psl)), fone(0.8f+(1.f-snap->psl)), 1.f);
+    partColor(PART_REPEL, fone(0.095f+(1.f-snap->pre)), fone(0.069f+(1.f-snap->pre)), fone(0.041f+(1.f-snap->pre)), 1.f);
+    partColor(PART_ELIPSE, 0.f, 0.717, 0.8f, snap->sa);
+
+    const GLsizei n = snap->sa > 0.f ? PARTS : PART_ELIPSE;
+    if(n == PARTS)
+        partMatrix(&part_mv[PART_ELIPSE], x, y+1.f, z, rx, 0.f);
+    glUniformMatrix4fv(modelview_id, n, GL_FALSE, (f32*) &part_mv[0].m[0][0]);
+    glUniform4fv(color_id, n, &part_color[0]);
+
+    esUseModel(&mdlPlayer);
+    glDrawElements(GL_TRIANGLES, player_numind, GL_UNSIGNED_SHORT, 0);
+    if(n == PARTS)
+    {
+        glEnable(GL_BLEND);
+        glDrawElements(GL_TRIANGLES, shield_numind, GL_UNSIGNED_SHORT, (void*)(size_t)(player_numind*sizeof(GLushort)));
+        glDisable(GL_BLEND);
+    }
+}
 
-    if(lf == 1)
-        rLeftFlame(x, y+2.6f, z, rx);
-    if(rf == 1)
-        rRightFlame(x, y+2.6f, z, rx);
+//*************************************
+// game functions
+//*************************************
+// empties every colour slot
+void resetColorSlots()
+{
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        color_slot[i] = -1;
+    for(unsigned int s = 0; s < color_slots; s++)
+        slot_rock[s] = ARRAY_MAX, slot_frame[s] = 0;
+    slot_hand = 0;
+    slot_full = 0;
+    color_frame = 1;
+}
 
-    rFace(x, y+3.4f, z, rx);
-    rBreak(x, y+3.4f, z, rx);
-    rShield(x, y+3.4f, z, rx);
-    rSlow(x, y+3.4f, z, rx);
-    rRepel(x, y+3.4f, z, rx);
+void uTitle()
+{
+    timeTaken(1);
+    char title[256];
+    //sprintf(title, "Space Miner - Fuel %u - Mined %u - Time %s", (uint)(snap->pf*100.f), snap->pm, tts);
+    sprintf(title, "| %s | Fuel %u | Speed %.2f | Mined %u |", tts, (uint)(snap->pf*100.f), snap->psp*100.f, snap->pm);
+    glfwSetWindowTitle(window, title);
+}
+
+// a mined rock has had its minerals refined out, so its tints go too, its
+// slot is given up and it is flagged SNAP_SPENT, so it is made dark next draw
+void uMined(unsigned int i)
+{
+    if(color_slot[i] >= 0)
+    {
+        slot_rock[color_slot[i]] = ARRAY_MAX;
+        color_slot[i] = -1;
+    }
+}
+
+// settings that are not the renderer's, sim.h takes the world size ones
+int gameOption(const char* opt)
+{
+    if(strncmp(opt, "color_radius=", 13) == 0)
+    {
+        color_radius = atof(opt+13);
+        return 1;
+    }
+    if(strncmp(opt, "simthread=", 10) == 0)
+    {
+        simthread = atoi(opt+10) != 0;
+        return 1;
+    }
+    return sim_option(opt);
+}
+
+// per rock render state, sized once the rock count is known, 0 if out of memory
+size_t render_bytes = 0;
+int allocRender()
+{
+    const size_t n = ARRAY_MAX;
+    color_slots = ARRAY_MAX < COLOR_SLOTS ? ARRAY_MAX : COLOR_SLOTS;
+    rock_lod = calloc(n, 1);
+    imp_data = malloc(n*8*sizeof(f32));
+    inst_near = malloc(n*sizeof(unsigned int));
+    color_slot = malloc(n*sizeof(int));
+    slot_rock = malloc(color_slots*sizeof(unsigned int));
+    slot_frame = malloc(color_slots*sizeof(unsigned int));
+    rock_chunk = malloc(n*sizeof(int));
+    stage_data = malloc(n*8*sizeof(f32));
+    stage_dist = malloc(n*sizeof(f32));
+    stage_lod = malloc(n);
+    render_bytes = n*(2 + 17*sizeof(f32) + sizeof(unsigned int) + 2*sizeof(int)) + color_slots*2*sizeof(unsigned int);
+    if(rock_lod == NULL || imp_data == NULL || inst_near == NULL || color_slot == NULL || slot_rock == NULL || slot_frame == NULL || rock_chunk == NULL ||
+       stage_data == NULL || stage_dist == NULL || stage_lod == NULL)
+        return 0;
+    if(instanced == 1)
+    {
+        for(uint l = 0; l < ROCK_LODS; l++)
+        {
+            inst_data[l] = malloc(n*8*sizeof(f32));
+            if(inst_data[l] == NULL)
+                return 0;
+        }
+        render_bytes += ROCK_LODS*n*8*sizeof(f32);
+    }
+    return 1;
+}
 
-    if(so > 0.f)
+// a sector streamed in reuses a slot, the colours & LODs of the rocks it had go
+void uLoaded(unsigned int slot)
+{
+    const unsigned int first = slot * w.sector_rocks;
+    for(unsigned int i = first; i < first + w.sector_rocks; i++)
     {
-        const f32 ss = 1.f-(so*RECIP_MAX_ROCK_SCALE);
-        if(ps == 0.f)
+        if(color_slot[i] >= 0)
         {
-            pf -= FUEL_DRAIN_RATE * ss * dt;
-            pf = fzero(pf);
+            slot_rock[color_slot[i]] = ARRAY_MAX;
+            color_slot[i] = -1;
         }
-        else
+        rock_lod[i] = 0;
+    }
+}
+
+// the chunk a sleeping rock at p goes in, a new one or one left empty if no chunk has that cell, -1 if out of memory
+static int chunkAt(const vec p)
+{
+    const int x = (int)floorf(p.x / CHUNK_SIZE), y = (int)floorf(p.y / CHUNK_SIZE), z = (int)floorf(p.z / CHUNK_SIZE);
+    int e = -1;
+    for(unsigned int j = 0; j < chunk_num; j++)
+    {
+        const chunk* c = &chunks[j];
+        if(c->x == x && c->y == y && c->z == z)
+            return j;
+        if(e < 0 && c->num == 0)
+            e = j;
+    }
+    if(e < 0)
+    {
+        if(chunk_num == chunk_max)
         {
-            ps -= SHIELD_DRAIN_RATE * ss * dt;
-            ps = fzero(ps);
+            const unsigned int m = chunk_max == 0 ? 64 : chunk_max*2;
+            chunk* n = realloc(chunks, m*sizeof(chunk));
+            if(n == NULL)
+                return -1;
+            chunks = n;
+            chunk_max = m;
+        }
+        e = chunk_num++;
+        memset(&chunks[e], 0, sizeof(chunk));
+    }
+    chunks[e].x = x, chunks[e].y = y, chunks[e].z = z;
+    return e;
+}
 
-            rShieldElipse(x, y+1.f, z, rx, fsat(ss));
+// a rock that fell asleep or woke moves into or out of its chunk, p is where it sleeps
+void uStirred(unsigned int i, unsigned int flag, vec p)
+{
+    if(rock_chunk[i] >= 0)
+    {
+        chunk* c = &chunks[rock_chunk[i]];
+        for(unsigned int j = 0; j < c->num; j++)
+        {
+            if(c->rocks[j].i == i)
+            {
+                c->rocks[j] = c->rocks[--c->num];
+                break;
+            }
         }
-        //printf("s: %g\n", ps);
+        c->dirty = 1;
+        rock_chunk[i] = -1;
     }
+    if((flag & SNAP_ASLEEP) == 0)
+        return;
+
+    const int j = chunkAt(p);
+    if(j < 0)
+        return;
+    chunk* c = &chunks[j];
+    if(c->num == c->max)
+    {
+        const unsigned int m = c->max == 0 ? 64 : c->max*2;
+        sleeper* n = realloc(c->rocks, m*sizeof(sleeper));
+        if(n == NULL)
+            return;
+        c->rocks = n;
+        c->max = m;
+    }
+    c->rocks[c->num++] = (sleeper){i, flag, p};
+    c->dirty = 1;
+    rock_chunk[i] = j;
 }
 
-//*************************************
-// game functions
-//*************************************
-void newGame(unsigned int seed)
+// empties every chunk, their buffers are kept for the next rocks to sleep
+void resetChunks()
 {
-    srand(seed);
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        rock_chunk[i] = -1;
+    for(unsigned int j = 0; j < chunk_num; j++)
+    {
+        chunks[j].num = 0;
+        chunks[j].dirty = 1;
+    }
+}
 
+// the sim thread has made a new world, everything kept for the last one goes
+void newGame(unsigned int seed)
+{
     char strts[16];
     timestamp(&strts[0]);
     printf("\n[%s] Game Start [%u].\n", strts, seed);
     
     glfwSetWindowTitle(window, "Space Miner");
 
-#ifndef __arm__
-    const f32 scalar = esRandFloat(8.f, 12.f);
-    FAR_DISTANCE = (float)ARRAY_MAX / scalar;
-    printf("Far Distance Divisor: %g\n", scalar);
-#endif
-    
-    pp = (vec){0.f, 0.f, 0.f};
-    pv = (vec){0.f, 0.f, 0.f};
-    pd = (vec){0.f, 0.f, 0.f};
-    pld = (vec){0.f, 0.f, 0.f};
-
-    st = 0;
+    resetColorSlots();
+    resetChunks();
 
+    st = t;
     lf = 100;
+}
 
-    ct = 0;
-    pm = 0;
-    so = 0.f;
-    pr = 0.f;
-    lgr = 0.f;
-
-    pf = 1.f;
-    pb = 1.f;
-    ps = 1.f;
-    psl = 0.f;
-    pre = 0.f;
-    psp = 0.f;
-
-    for(uint i = 0; i < ARRAY_MAX; i++)
+// takes the newest snapshot and catches up on what changed before it, in order
+void uSnapshot()
+{
+    snap = snapTake();
+    uint mined = 0;
+    snapevent e;
+    while(snapNext(snap, &e) == 1)
     {
-        array_rocks[i].free = 0;
-        array_rocks[i].scale = esRandFloat(0.1f, MAX_ROCK_SCALE);
-        array_rocks[i].pos.x = esRandFloat(-FAR_DISTANCE, FAR_DISTANCE);
-        array_rocks[i].pos.y = esRandFloat(-FAR_DISTANCE, FAR_DISTANCE);
-        array_rocks[i].pos.z = esRandFloat(-FAR_DISTANCE, FAR_DISTANCE);
-
-        array_rocks[i].rnd = esRand(0, 1000);
-        array_rocks[i].rndf = esRandFloat(0.05f, 0.3f);
-
-        if(esRand(0, 1000) < 500)
-        {
-            array_rocks[i].qshield = esRandFloat(0.f, 1.f);
-            array_rocks[i].qbreak = esRandFloat(0.f, 1.f);
-            array_rocks[i].qslow = esRandFloat(0.f, 1.f);
-            array_rocks[i].qrepel = esRandFloat(0.f, 1.f);
-            array_rocks[i].qfuel = esRandFloat(0.f, 1.f);
-        }
-        else
-        {
-            array_rocks[i].qshield = 0.f;
-            array_rocks[i].qbreak = 0.f;
-            array_rocks[i].qslow = 0.f;
-            array_rocks[i].qrepel = 0.f;
-            array_rocks[i].qfuel = 0.f;
-            array_rocks[i].nores = 1;
-        }
-
-        for(uint j = 0; j < 720; j += 3)
-        {
-            uint set = 0;
-            #define CLR_CHANCE 0.01f
-
-            // break
-            if(esRandFloat(0.f, 1.f) < array_rocks[i].qbreak*CLR_CHANCE)
-            {
-                array_rocks[i].colors[j] = 0.644f;
-                array_rocks[i].colors[j+1] = 0.209f;
-                array_rocks[i].colors[j+2] = 0.f;
-                set = 1;
-            }
-
-            // shield
-            if(set == 0 && esRandFloat(0.f, 1.f) < array_rocks[i].qshield*CLR_CHANCE)
-            {
-                array_rocks[i].colors[j] = 0.f;
-                array_rocks[i].colors[j+1] = 0.8f;
-                array_rocks[i].colors[j+2] = 0.28f;
-                set = 1;
-            }
-
-            // slow
-            if(set == 0 && esRandFloat(0.f, 1.f) < array_rocks[i].qslow*CLR_CHANCE)
-            {
-                array_rocks[i].colors[j] = 0.429f;
-                array_rocks[i].colors[j+1] = 0.f;
-                array_rocks[i].colors[j+2] = 0.8f;
-                set = 1;
-            }
-
-            // repel
-            if(set == 0 && esRandFloat(0.f, 1.f) < array_rocks[i].qrepel*CLR_CHANCE)
-            {
-                array_rocks[i].colors[j] = 0.095f;
-                array_rocks[i].colors[j+1] = 0.069f;
-                array_rocks[i].colors[j+2] = 0.041f;
-                set = 1;
-            }
-
-            // fuel
-            if(set == 0 && esRandFloat(0.f, 1.f) < array_rocks[i].qfuel*CLR_CHANCE)
-            {
-                array_rocks[i].colors[j] = 0.062f;
-                array_rocks[i].colors[j+1] = 1.f;
-                array_rocks[i].colors[j+2] = 0.873f;
-                set = 1;
-            }
-
-            // else
-            if(set == 0)
-            {
-                array_rocks[i].colors[j] = ROCK_DARKNESS;
-                array_rocks[i].colors[j+1] = ROCK_DARKNESS;
-                array_rocks[i].colors[j+2] = ROCK_DARKNESS;
-            }
-        }
+        if(e.kind == SNAP_MINED)
+            uMined(e.i), mined = 1;
+        else if(e.kind == SNAP_LOADED)
+            uLoaded(e.i);
+        else if(e.kind == SNAP_STIRRED)
+            uStirred(e.i, e.flag, e.p);
+        else if(e.kind == SNAP_NEWGAME)
+            newGame(e.i), mined = 0;
+    }
+    if(mined == 1)
+        uTitle();
 
-        vRuv(&array_rocks[i].vel);
+    // each input from when it happened to this frame, the first drawn with it acted on
+    for(; cmd_shown < snap->inputs; cmd_shown++)
+    {
+        const command* c = &cmd_ring[cmd_shown % CMD_QUEUE];
+        if(c->kind != CMD_YAW)
+            telLatency((t - c->t) * 1e3);
     }
 
-    st = t;
+    // out of fuel the sim drops the thrust keys, so the flames go out too
+    if(snap->pf == 0.f)
+        memset(&inp.keys[0], 0x00, sizeof(uint)*6);
 }
 
 //*************************************
-// update & render
+// simulation
 //*************************************
-void main_loop()
+// render thread, 0 if the sim is a whole ring behind and it was dropped
+int cmdPush(uint kind, unsigned int u, f32 f, double when)
 {
-//*************************************
-// time delta for interpolation
-//*************************************
-    static double lt = 0;
-    dt = t-lt;
-    lt = t;
+    if(cmd_head - cmd_shown >= CMD_QUEUE)
+        return 0;
+    command* c = &cmd_ring[cmd_head % CMD_QUEUE];
+    c->t = when;
+    c->u = u;
+    c->f = f;
+    c->kind = kind;
+    __atomic_store_n(&cmd_head, cmd_head+1, __ATOMIC_RELEASE);
+    return 1;
+}
 
-//*************************************
-// keystates
-//*************************************
-    if(pf == 0.f) // disable thrust control on fuel empty
-        memset(&keystate[0], 0x00, sizeof(uint)*6);
+// inp.keys is what is held, for the flames, a change is pushed when it happens
+// and cmdSync() pushes it again each frame until it gets on the ring
+void cmdKey(uint k, uint down, double when)
+{
+    inp.keys[k] = down;
+    if(cmd_keys[k] != down && cmdPush(CMD_KEY, k<<1 | down, 0.f, when) == 1)
+        cmd_keys[k] = down;
+}
 
-    if(keystate[0] == 1)
-    {
-        pr += 3.f * dt;
-        lgr = pr;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
-    }
+// the thrust keys & camera yaw the sim doesn't have yet
+void cmdSync(double when)
+{
+    for(uint k = 0; k < 6; k++)
+        cmdKey(k, inp.keys[k], when);
+    if(xrot != inp.xrot && cmdPush(CMD_YAW, 0, xrot, when) == 1)
+        inp.xrot = xrot;
+}
 
-    if(keystate[1] == 1)
-    {
-        pr -= 3.f * dt;
-        lgr = pr;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
-    }
-    
-    if(keystate[2] == 1)
-    {
-        ct = 1;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
-    }
+// a key or a button, -1 for none, pressed or released
+void cmdInput(int key, int button, uint down)
+{
+    const double now = glfwGetTime();
+    for(uint i = 0; i < sizeof(bindings)/sizeof(binding) && down == 1; i++)
+        if(bindings[i].key == key || bindings[i].button == button)
+            cmdPush(bindings[i].cmd, 0, 0.f, now);
+    for(uint i = 0; i < 6; i++)
+        if(thrust_keys[i] == key)
+            cmdKey(i, down, now);
+}
 
-    if(keystate[3] == 1)
-    {
-        ct = 2;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
-    }
+// a new world, published straight away so it is one snapshot's events
+void simNew(unsigned int seed, double now)
+{
+    sim_new(&w, seed);
+    snapEvent(SNAP_NEWGAME, seed, 0, (vec){0});
+    snapPublish(&w, now, sim_acc, cmd_tail);
+}
 
-    if(keystate[4] == 1)
+// acts on the commands that happened by the end of the step about to be taken,
+// returns 1 after a new game, the commands after it wait for the next advance
+static uint simCommands(double end, double now)
+{
+    const unsigned long long head = __atomic_load_n(&cmd_head, __ATOMIC_ACQUIRE);
+    while(cmd_tail < head && cmd_ring[cmd_tail % CMD_QUEUE].t <= end)
     {
-        pv.y -= THRUST_POWER * dt;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
+        const command c = cmd_ring[cmd_tail % CMD_QUEUE];
+        cmd_tail++;
+        if(c.kind == CMD_BREAK)
+            sim_break(&w);
+        else if(c.kind == CMD_REPEL)
+            sim_repel(&w);
+        else if(c.kind == CMD_STOP)
+            sim_stop(&w);
+        else if(c.kind == CMD_KEY)
+            sim_inp.keys[c.u>>1] = c.u & 1;
+        else if(c.kind == CMD_YAW)
+            sim_inp.xrot = c.f;
+        else if(c.kind == CMD_NEWGAME)
+        {
+            simNew(c.u, now);
+            return 1;
+        }
     }
+    return 0;
+}
 
-    if(keystate[5] == 1)
+// fixed rate steps for dt, each after the commands that fall in it, the
+// remainder carries over and the renderer interpolates it, then a snapshot
+void simAdvance(double dt, double now)
+{
+    sim_acc += dt;
+    if(sim_acc > 0.25){sim_acc = 0.25;} // after a stall drop the backlog rather than spiral
+    while(sim_acc >= SIM_DT)
     {
-        pv.y += THRUST_POWER * dt;
-        pf -= FUEL_DRAIN_RATE * dt;
-        pf = fzero(pf);
+        sim_acc -= SIM_DT;
+        if(simCommands(now - sim_acc, now) == 1)
+            return;
+        sim_step(&w, &sim_inp, SIM_DT);
     }
+    snapPublish(&w, now, sim_acc, cmd_tail);
+}
 
-    static double ltut = 3.0;
-    const uint nf = pf*100.f;
-    if(nf != lf)
-    {
-        char strts[16];
-        timestamp(&strts[0]);
-        printf("[%s] Fuel: %.2f - Speed: %g\n", strts, pf, psp*100.f);
-    }
-    if(nf != lf || t > ltut)
+// steps in real time and sleeps until the next step is due, vsync & slow frames don't hold it up
+void* simMain(void* arg)
+{
+    double lt = glfwGetTime();
+    while(__atomic_load_n(&sim_quit, __ATOMIC_ACQUIRE) == 0)
     {
-        timeTaken(1);
-        char title[256];
-        //sprintf(title, "Space Miner - Fuel %u - Mined %u - Time %s", nf, pm, tts);
-        sprintf(title, "| %s | Fuel %u | Speed %.2f | Mined %u |", tts, (uint)(pf*100.f), psp*100.f, pm);
-        glfwSetWindowTitle(window, title);
-        lf = nf;
-        ltut = t + 3.0;
+        const double now = glfwGetTime();
+        simAdvance(now-lt, now);
+        lt = now;
+        const double wait = SIM_DT - sim_acc;
+        if(wait > 0.0)
+            nanosleep(&(struct timespec){0, (long)(wait*1e9)}, NULL);
     }
+    return NULL;
+}
+
+//*************************************
+// benchmark
+//*************************************
+// the same flight as headless.c, one fixed step a frame so every run is the same
+void benchInput()
+{
+    const GLuint f = bench_frame;
+    t = (double)f * SIM_DT;
+    cmdKey(2, 1, t);
+    cmdKey(0, (f % 600) < 30, t);       // turn left half a second every ten
+    cmdKey(5, (f % 900) >= 450 && (f % 900) < 480, t); // and climb for half a second every fifteen
+    xrot = snap->pr;                    // camera behind the player
+    yrot = 0.2f * sinf(t * 0.5f);
+
+    if(f % 30 == 0){cmdPush(CMD_BREAK, 0, 0.f, t);}
+    if(f % 120 == 60){cmdPush(CMD_REPEL, 0, 0.f, t);}
+    if(f % 600 == 300){cmdPush(CMD_STOP, 0, 0.f, t);}
+}
 
-    // increment player direction
-    if(ct > 0)
+// one line of key=value pairs, easy to grep & diff between builds
+void benchReport(double seconds, int msaa)
+{
+    float p[4];
+    telStats(TEL_PHASES, &p[0]);
+    printf("BENCH seed=%u frames=%u seconds=%.3f fps=%.2f p50_ms=%.3f p95_ms=%.3f p99_ms=%.3f max_ms=%.3f", NEWGAME_SEED, bench_frame, seconds, bench_frame/seconds, p[0], p[1], p[2], p[3]);
+    for(uint i = 0; i < TEL_PHASES; i++)
     {
-        vec inc;
-        if(ct == 1)
-            vMulS(&inc, pd, THRUST_POWER * dt);
-        else if(ct == 2)
-            vMulS(&inc, pd, -THRUST_POWER * dt);
-        vAdd(&pv, pv, inc);
+        telStats(i, &p[0]);
+        printf(" %s_p50_ms=%.3f %s_p99_ms=%.3f", tel_names[i], p[0], tel_names[i], p[2]);
     }
-    vAdd(&pp, pp, pv);
+    const ESStateStats ss = esStateStats();
+    printf(" binds=%.0f binds_skipped=%.0f uniforms=%.0f uniforms_skipped=%.0f", (double)ss.binds/bench_frame, (double)ss.binds_skipped/bench_frame, (double)ss.uniforms/bench_frame, (double)ss.uniforms_skipped/bench_frame);
+    printf(" rock_tris=%.0f impostors=%.0f chunks=%.0f lod=%u", (double)rock_tris/bench_frame, (double)imp_total/bench_frame, (double)chunk_total/bench_frame, nolod == 0);
+    printf(" rocks=%u active=%u msaa=%i instanced=%u mined=%u renderer=\"%s\"\n", ARRAY_MAX, snap->num, msaa, instanced, snap->pm, glGetString(GL_RENDERER));
+}
+
+//*************************************
+// update & render
+//*************************************
+void main_loop()
+{
+//*************************************
+// time delta
+//*************************************
+    static double lt = -1;
+    if(lt < 0){lt = t;}
+    dt = t-lt;
+    lt = t;
+    if(bench > 0){dt = SIM_DT;}
 
 //*************************************
 // camera
@@ -1098,12 +1281,44 @@ void main_loop()
             glfwSetCursorPos(window, ww2, wh2);
         }
     }
+    telMark(TEL_INPUT);
+
+//*************************************
+// simulate
+//*************************************
+    // the sim thread steps on its own, otherwise it is stepped here, then the newest snapshot
+    // is drawn, interpolated by the step time it had left over plus the time since
+    cmdSync(t); // the cursor is read once a frame
+    if(simthread == 0)
+        simAdvance(dt, t);
+    uSnapshot();
+    alpha = (snap->acc + (t - snap->t)) * SIM_HZ;
+    if(alpha < 0.f){alpha = 0.f;}
+    if(alpha > 1.f){alpha = 1.f;}
+    const vec rpp = lerpv(snap->lpp, snap->pp);
+    const f32 rpr = snap->lpr + (snap->pr-snap->lpr)*alpha;
+
+    static double ltut = 3.0;
+    const uint nf = snap->pf*100.f;
+    if(nf != lf)
+    {
+        char strts[16];
+        timestamp(&strts[0]);
+        printf("[%s] Fuel: %.2f - Speed: %g\n", strts, snap->pf, snap->psp*100.f);
+    }
+    if(nf != lf || t > ltut)
+    {
+        uTitle();
+        lf = nf;
+        ltut = t + 3.0;
+    }
+    telMark(TEL_SIM);
 
     mIdent(&view);
     mTranslate(&view, 0.f, -1.5f, zoom);
     mRotate(&view, yrot, 1.f, 0.f, 0.f);
     mRotate(&view, xrot, 0.f, 1.f, 0.f);
-    mTranslate(&view, -pp.x, -pp.y, -pp.z);
+    mTranslate(&view, -rpp.x, -rpp.y, -rpp.z);
 
 //*************************************
 // begin render
@@ -1115,36 +1330,41 @@ void main_loop()
 //*************************************
 
     // render player
-    shadeLambert1(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id);
-    glUniformMatrix4fv(projection_id, 1, GL_FALSE, (f32*) &projection.m[0][0]);
-    glUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
-    rPlayer(pp.x, pp.y, pp.z, pr);
+    shadeLambert1P(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &part_id);
+    esUniformMatrix4fv(projection_id, (f32*) &projection.m[0][0]);
+    esUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    rPlayer(rpp.x, rpp.y, rpp.z, rpr);
+    telMark(TEL_PLAYER);
 
     // render asteroids
-    shadeLambert3(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id);
-    glUniformMatrix4fv(projection_id, 1, GL_FALSE, (f32*) &projection.m[0][0]);
-    glUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
-    so = 0.f;
-    for(uint i = 0; i < ARRAY_MAX; i++)
+    shadeLambert3I(&position_id, &projection_id, &modelview_id, &lightpos_id, &normal_id, &color_id, &opacity_id, &offset_id, &spin_id, &time_id);
+    esUniformMatrix4fv(projection_id, (f32*) &projection.m[0][0]);
+    esUniformMatrix4fv(modelview_id, (f32*) &view.m[0][0]);
+    esUniform3f(lightpos_id, lightpos.x, lightpos.y, lightpos.z);
+    esUniform1f(opacity_id, 1.0f);
+    esUniform1f(time_id, t);
+    color_frame++;
+    poolRun(stageRocks, (void*)&rpp, (snap->num + STEP_RUN-1) / STEP_RUN);
+    for(unsigned int k = 0; k < snap->num; k++)
     {
-        if(array_rocks[i].free != 1)
-        {
-            vec inc;
-            vMulS(&inc, array_rocks[i].vel, dt);
-            vAdd(&array_rocks[i].pos, array_rocks[i].pos, inc);
-
-            const f32 dist = vDist(pp, array_rocks[i].pos);
-            if(dist < 10.f + array_rocks[i].scale)
-                if(so == 0.f || dist < so){so = dist;}
-
-            rRock(i, dist);
-        }
+        if(stage_lod[k] == STAGE_ASLEEP)
+            continue;
+        if(instanced == 1)
+            iRock(k);
+        else
+            rRock(k);
     }
+    if(instanced == 1)
+        rRocksInstanced();
+    rChunks(rpp);
+    rImpostors();
+    telMark(TEL_ROCKS);
 
 //*************************************
 // swap buffers / display render
 //*************************************
     glfwSwapBuffers(window);
+    telMark(TEL_SWAP);
 }
 
 //*************************************
@@ -1155,26 +1375,22 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
     // control
     if(action == GLFW_PRESS)
     {
-        if(key == GLFW_KEY_A){ keystate[0] = 1; }
-        else if(key == GLFW_KEY_D){ keystate[1] = 1; }
-        else if(key == GLFW_KEY_W){ keystate[2] = 1; }
-        else if(key == GLFW_KEY_S){ keystate[3] = 1; }
-        else if(key == GLFW_KEY_LEFT_SHIFT){ keystate[4] = 1; }
-        else if(key == GLFW_KEY_SPACE){ keystate[5] = 1; }
+        // thrust & player actions
+        cmdInput(key, -1, 1);
 
         // new game
-        else if(key == GLFW_KEY_N)
+        if(key == GLFW_KEY_N)
         {
             // end
             timeTaken(0);
             char strts[16];
             timestamp(&strts[0]);
-            printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, pf, pb, ps, psl, pre, pm);
+            printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, snap->pf, snap->pb, snap->ps, snap->psl, snap->pre, snap->pm);
             printf("[%s] Time-Taken: %s or %g Seconds\n", strts, tts, t-st);
             printf("[%s] Game End.\n", strts);
             
             // new
-            newGame(time(0));
+            cmdPush(CMD_NEWGAME, time(0), 0.f, glfwGetTime());
         }
 
         // stats
@@ -1182,105 +1398,7 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
         {
             char strts[16];
             timestamp(&strts[0]);
-            printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, pf, pb, ps, psl, pre, pm);
-        }
-
-        // break rocks
-        else if(key == GLFW_KEY_Q && pb > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 30.f + array_rocks[i].scale)
-                    {
-                        pb -= 0.06f;
-                        pb = fzero(pb); // hack, yes user could mine beyond pb == 0.f in this loop, take it as a last chance
-
-                        pf += array_rocks[i].qfuel * REFINARY_YEILD * 3.f;
-                        pb += array_rocks[i].qbreak * REFINARY_YEILD;
-                        ps += array_rocks[i].qshield * REFINARY_YEILD;
-                        psl += array_rocks[i].qslow * REFINARY_YEILD;
-                        pre += array_rocks[i].qrepel * REFINARY_YEILD;
-
-                        pf = fone(pf);
-                        pb = fone(pb);
-                        ps = fone(ps);
-                        psl = fone(psl);
-                        pre = fone(pre);
-
-                        array_rocks[i].free = 2;
-                        pm++;
-
-                        timeTaken(1);
-                        char title[256];
-                        //sprintf(title, "Space Miner - Fuel %u - Mined %u - Time %s", (uint)(pf*100.f), pm, tts);
-                        sprintf(title, "| %s | Fuel %u | Speed %.2f | Mined %u |", tts, (uint)(pf*100.f), psp*100.f, pm);
-                        glfwSetWindowTitle(window, title);
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f\n", strts, pb, ps, psl, pre);
-                        printf("[%s] Mined: %u\n", strts, pm);
-                    }
-                }
-            }
-        }
-
-        // stop all rocks
-        else if(key == GLFW_KEY_E && psl > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0 && array_rocks[i].rndf != 0.f)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 333.f + array_rocks[i].scale)
-                    {
-                        psl -= 0.06f;
-                        if(psl <= 0.f)
-                        {
-                            psl = 0.f;
-                            break;
-                        }
-                        array_rocks[i].vel = (vec){0.f, 0.f, 0.f};
-                        array_rocks[i].rndf = 0.f;
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Repel %.2f\n", strts, psl);
-                    }
-                }
-            }
-        }
-
-        // repel rock
-        else if(key == GLFW_KEY_R && pre > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 30.f + array_rocks[i].scale)
-                    {
-                        //vRuv(&array_rocks[i].vel);
-                        pre -= 0.06f;
-                        if(pre <= 0.f)
-                        {
-                            pre = 0.f;
-                            break;
-                        }
-                        array_rocks[i].vel = pfd;
-                        vMulS(&array_rocks[i].vel, array_rocks[i].vel, 42.f);
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Stop %.2f\n", strts, pre);
-                    }
-                }
-            }
+            printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, snap->pf, snap->pb, snap->ps, snap->psl, snap->pre, snap->pm);
         }
 
         // toggle mouse focus
@@ -1297,14 +1415,7 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
         }
     }
     else if(action == GLFW_RELEASE)
-    {
-        if(key == GLFW_KEY_A){ keystate[0] = 0; }
-        else if(key == GLFW_KEY_D){ keystate[1] = 0; }
-        else if(key == GLFW_KEY_W){ keystate[2] = 0; }
-        else if(key == GLFW_KEY_S){ keystate[3] = 0; }
-        else if(key == GLFW_KEY_LEFT_SHIFT){ keystate[4] = 0; }
-        else if(key == GLFW_KEY_SPACE){ keystate[5] = 0; }
-    }
+        cmdInput(key, -1, 0);
 
     // show average fps
     if(key == GLFW_KEY_F)
@@ -1314,6 +1425,9 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
             char strts[16];
             timestamp(&strts[0]);
             printf("[%s] FPS: %g\n", strts, fc/(t-lfct));
+            const ESStateStats ss = esStateStats();
+            printf("[%s] State cache: %.0f of %.0f binds and %.0f of %.0f uniforms skipped per frame\n", strts, ss.binds_skipped/fc, ss.binds/fc, ss.uniforms_skipped/fc, ss.uniforms/fc);
+            telReport();
             lfct = t;
             fc = 0;
         }
@@ -1333,102 +1447,7 @@ void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
 {
     if(action == GLFW_PRESS)
-    {
-        if(button == GLFW_MOUSE_BUTTON_LEFT && pb > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 30.f + array_rocks[i].scale)
-                    {
-                        pb -= 0.06f;
-                        pb = fzero(pb); // hack, yes user could mine beyond pb == 0.f in this loop, take it as a last chance
-
-                        pf += array_rocks[i].qfuel * REFINARY_YEILD * 3.f;
-                        pb += array_rocks[i].qbreak * REFINARY_YEILD;
-                        ps += array_rocks[i].qshield * REFINARY_YEILD;
-                        psl += array_rocks[i].qslow * REFINARY_YEILD;
-                        pre += array_rocks[i].qrepel * REFINARY_YEILD;
-
-                        pf = fone(pf);
-                        pb = fone(pb);
-                        ps = fone(ps);
-                        psl = fone(psl);
-                        pre = fone(pre);
-
-                        array_rocks[i].free = 2;
-                        pm++;
-
-                        timeTaken(1);
-                        char title[256];
-                        //sprintf(title, "Space Miner - Fuel %u - Mined %u - Time %s", (uint)(pf*100.f), pm, tts);
-                        sprintf(title, "| %s | Fuel %u | Speed %.2f | Mined %u |", tts, (uint)(pf*100.f), psp*100.f, pm);
-                        glfwSetWindowTitle(window, title);
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f\n", strts, pb, ps, psl, pre);
-                        printf("[%s] Mined: %u\n", strts, pm);
-                    }
-                }
-            }
-        }
-
-        if(button == GLFW_MOUSE_BUTTON_RIGHT && pre > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 30.f + array_rocks[i].scale)
-                    {
-                        //vRuv(&array_rocks[i].vel);
-                        pre -= 0.06f;
-                        if(pre <= 0.f)
-                        {
-                            pre = 0.f;
-                            break;
-                        }
-                        array_rocks[i].vel = pfd;
-                        vMulS(&array_rocks[i].vel, array_rocks[i].vel, 42.f);
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Repel %.2f\n", strts, pre);
-                    }
-                }
-            }
-        }
-
-        if(button == GLFW_MOUSE_BUTTON_4 && psl > 0.f)
-        {
-            for(uint i = 0; i < ARRAY_MAX; i++)
-            {
-                if(array_rocks[i].free == 0 && array_rocks[i].rndf != 0.f)
-                {
-                    const f32 dist = vDist(pp, array_rocks[i].pos);
-                    if(dist < 333.f + array_rocks[i].scale)
-                    {
-                        psl -= 0.06f;
-                        if(psl <= 0.f)
-                        {
-                            psl = 0.f;
-                            break;
-                        }
-                        array_rocks[i].vel = (vec){0.f, 0.f, 0.f};
-                        array_rocks[i].rndf = 0.f;
-
-                        char strts[16];
-                        timestamp(&strts[0]);
-                        printf("[%s] Stop %.2f\n", strts, psl);
-                    }
-                }
-            }
-        }
-    }
+        cmdInput(-1, button, 1);
 }
 
 void window_size_callback(GLFWwindow* window, int width, int height)
@@ -1453,6 +1472,149 @@ void window_size_callback(GLFWwindow* window, int width, int height)
     mPerspective(&projection, 60.0f, aspect, 1.0f, FAR_DISTANCE*2.f); 
 }
 
+//*************************************
+// player mesh
+//*************************************
+typedef struct
+{
+    const GLfloat* vertices;
+    const GLfloat* normals;
+    const GLushort* indices;
+    GLsizeiptr numvert, numind;
+} partsrc;
+
+// merges the astronaut's parts in PART_ order into mdlPlayer
+void bindPlayer()
+{
+    const partsrc src[PARTS] = {
+        {legs_vertices, legs_normals, legs_indices, legs_numvert, legs_numind},
+        {body_vertices, body_normals, body_indices, body_numvert, body_numind},
+        {fuel_vertices, fuel_normals, fuel_indices, fuel_numvert, fuel_numind},
+        {arms_vertices, arms_normals, arms_indices, arms_numvert, arms_numind},
+        {left_flame_vertices, left_flame_normals, left_flame_indices, left_flame_numvert, left_flame_numind},
+        {right_flame_vertices, right_flame_normals, right_flame_indices, right_flame_numvert, right_flame_numind},
+        {face_vertices, face_normals, face_indices, face_numvert, face_numind},
+        {pbreak_vertices, pbreak_normals, pbreak_indices, pbreak_numvert, pbreak_numind},
+        {pshield_vertices, pshield_normals, pshield_indices, pshield_numvert, pshield_numind},
+        {pslow_vertices, pslow_normals, pslow_indices, pslow_numvert, pslow_numind},
+        {prepel_vertices, prepel_normals, prepel_indices, prepel_numvert, prepel_numind},
+        {shield_vertices, shield_normals, shield_indices, shield_numvert, shield_numind}
+    };
+
+    GLsizeiptr nv = 0, ni = 0;
+    for(GLuint j = 0; j < PARTS; j++)
+        nv += src[j].numvert, ni += src[j].numind;
+
+    GLfloat* vertices = malloc(nv*3*sizeof(GLfloat));
+    GLfloat* normals = malloc(nv*3*sizeof(GLfloat));
+    GLfloat* parts = malloc(nv*sizeof(GLfloat));
+    GLushort* indices = malloc(ni*sizeof(GLushort));
+
+    GLsizeiptr v = 0, k = 0;
+    for(GLuint j = 0; j < PARTS; j++)
+    {
+        memcpy(&vertices[v*3], src[j].vertices, src[j].numvert*3*sizeof(GLfloat));
+        memcpy(&normals[v*3], src[j].normals, src[j].numvert*3*sizeof(GLfloat));
+        for(GLsizeiptr i = 0; i < src[j].numvert; i++)
+            parts[v+i] = (GLfloat)j;
+        for(GLsizeiptr i = 0; i < src[j].numind; i++)
+            indices[k+i] = src[j].indices[i] + v;
+        if(j == PART_ELIPSE-1)
+            player_numind = k + src[j].numind;
+        v += src[j].numvert;
+        k += src[j].numind;
+    }
+
+    esBind(GL_ARRAY_BUFFER, &mdlPlayer.vid, vertices, nv*3*sizeof(GLfloat), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlPlayer.nid, normals, nv*3*sizeof(GLfloat), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlPlayer.pid, parts, nv*sizeof(GLfloat), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPlayer.iid, indices, ni*sizeof(GLushort), GL_STATIC_DRAW);
+
+    free(vertices);
+    free(normals);
+    free(parts);
+    free(indices);
+
+    // all parts start white & opaque, rPlayer() sets the ones that change
+    for(GLuint j = 0; j < PARTS; j++)
+    {
+        part_color[j*4] = 1.f, part_color[j*4+1] = 1.f;
+        part_color[j*4+2] = 1.f, part_color[j*4+3] = 1.f;
+    }
+    part_color[PART_LEFT_FLAME*4] = 0.062f, part_color[PART_LEFT_FLAME*4+2] = 0.873f;
+    part_color[PART_RIGHT_FLAME*4] = 0.062f, part_color[PART_RIGHT_FLAME*4+2] = 0.873f;
+}
+
+//*************************************
+// impostor atlas
+//*************************************
+// every rock mesh from IMP_ANGLES angles around Y, view space normals in
+// rgb & coverage in alpha, needs framebuffer objects (GL 3.0 or ES 2.0)
+void bakeImpostors()
+{
+    const GLsizei aw = IMP_ANGLES*IMP_CELL, ah = 9*IMP_CELL;
+    if(glGenFramebuffers == NULL)
+    {
+        impostors = 0;
+        return;
+    }
+
+    GLint fbo_last, vp[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fbo_last);
+    glGetIntegerv(GL_VIEWPORT, &vp[0]);
+
+    glGenTextures(1, &imp_tex);
+    glBindTexture(GL_TEXTURE_2D, imp_tex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, aw, ah, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    GLuint fbo, depth;
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, imp_tex, 0);
+    glGenRenderbuffers(1, &depth);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT16, aw, ah);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE)
+    {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        mat ortho;
+        mIdent(&ortho);
+        mOrtho(&ortho, -IMP_RADIUS, IMP_RADIUS, -IMP_RADIUS, IMP_RADIUS, -IMP_RADIUS, IMP_RADIUS);
+        shadeNormal(&position_id, &projection_id, &modelview_id, &normal_id);
+        esUniformMatrix4fv(projection_id, (f32*) &ortho.m[0][0]);
+        for(uint j = 0; j < 9; j++)
+        {
+            esUseModel(&mdlRock[j]);
+            for(uint k = 0; k < IMP_ANGLES; k++)
+            {
+                glViewport(k*IMP_CELL, j*IMP_CELL, IMP_CELL, IMP_CELL);
+                mIdent(&model);
+                mRotY(&model, (f32)k * x2PI / (f32)IMP_ANGLES);
+                esUniformMatrix4fv(modelview_id, (f32*) &model.m[0][0]);
+                glDrawElements(GL_TRIANGLES, rock1_numind, GL_UNSIGNED_SHORT, 0);
+            }
+        }
+    }
+    else
+    {
+        impostors = 0;
+        glDeleteTextures(1, &imp_tex);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo_last);
+    glViewport(vp[0], vp[1], vp[2], vp[3]);
+    glDeleteRenderbuffers(1, &depth);
+    glDeleteFramebuffers(1, &fbo);
+    bindstate = -1;
+}
+
 //*************************************
 // Process Entry Point
 //*************************************
@@ -1460,7 +1622,39 @@ int main(int argc, char** argv)
 {
     // allow custom msaa level
     int msaa = 16;
-    if(argc >= 2){msaa = atoi(argv[1]);}
+    for(int i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--instanced") == 0)
+            instanced = 1;
+        else if(strcmp(argv[i], "--nolod") == 0)
+            nolod = 1;
+        else if(strcmp(argv[i], "--noimpostor") == 0)
+            impostors = 0;
+        else if(strncmp(argv[i], "--bench", 7) == 0)
+            bench = argv[i][7] == '=' ? atoi(&argv[i][8]) : BENCH_FRAMES;
+#ifdef OFFSCREEN
+        else if(strncmp(argv[i], "--frames=", 9) == 0)
+            offscreen_frames = atoi(&argv[i][9]);
+        else if(strncmp(argv[i], "--ppm=", 6) == 0)
+            offscreen_ppm = atoi(&argv[i][6]);
+#endif
+        else if(strncmp(argv[i], "--config=", 9) == 0)
+        {
+            if(sim_config(&argv[i][9], gameOption) == 0)
+                printf("Could not read config: %s\n", &argv[i][9]);
+        }
+        else if(strncmp(argv[i], "--", 2) == 0)
+        {
+            if(gameOption(&argv[i][2]) == 0)
+                printf("Unknown option: %s\n", argv[i]);
+        }
+        else
+            msaa = atoi(argv[i]);
+    }
+#ifdef OFFSCREEN
+    if(bench > 0){offscreen_frames = 0;} // the benchmark ends itself
+#endif
+    if(bench > 0){simthread = 0;} // one step a frame, every run the same
 
     // help
     printf("----\n");
@@ -1468,10 +1662,10 @@ int main(int argc, char** argv)
     printf("----\n");
     printf("James William Fletcher (github.com/mrbid)\n");
     printf("----\n");
-    printf("There is only one command line argument, and that is the MSAA level 0-16.\n");
+    printf("Command line arguments are the MSAA level 0-16, --instanced for instanced asteroid rendering and --rocks=n for the asteroid count.\n");
     printf("----\n");
     printf("~ Keyboard Input:\n");
-    printf("F = FPS to console\n");
+    printf("F = FPS & frame time percentiles to console\n");
     printf("P = Player stats to console\n");
     printf("N = New Game\n");
     printf("Q = Break Asteroid\n");
@@ -1491,6 +1685,13 @@ int main(int argc, char** argv)
     printf("Scroll = Zoom in/out\n");
     printf("----\n");
 
+    // world, its snapshots & per rock render state
+    if(sim_init(&w) == 0 || snapInit(ARRAY_MAX, w.sectors) == 0 || allocRender() == 0)
+    {
+        printf("Out of memory for %u asteroids.\n", ARRAY_MAX);
+        exit(EXIT_FAILURE);
+    }
+
     // init glfw
     if(!glfwInit()){exit(EXIT_FAILURE);}
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
@@ -1510,13 +1711,31 @@ int main(int argc, char** argv)
     glfwSetScrollCallback(window, scroll_callback);
     glfwMakeContextCurrent(window);
     gladLoadGL(glfwGetProcAddress);
-    glfwSwapInterval(1); // 0 for immediate updates, 1 for updates synchronized with the vertical retrace, -1 for adaptive vsync
+    glfwSwapInterval(bench > 0 ? 0 : 1); // 0 for immediate updates, 1 for updates synchronized with the vertical retrace, -1 for adaptive vsync
+
+    // instancing is core in 3.3, otherwise it needs ARB_instanced_arrays & ARB_draw_instanced
+    if(instanced == 1 && GLAD_GL_VERSION_3_3 == 0)
+    {
+        if(glfwExtensionSupported("GL_ARB_instanced_arrays") && glfwExtensionSupported("GL_ARB_draw_instanced"))
+        {
+            glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glfwGetProcAddress("glVertexAttribDivisorARB");
+            glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glfwGetProcAddress("glDrawElementsInstancedARB");
+        }
+        if(glVertexAttribDivisor == NULL || glDrawElementsInstanced == NULL)
+        {
+            instanced = 0;
+            printf("Instancing is not supported, falling back to one draw call per asteroid.\n");
+        }
+    }
 
     // set icon
     glfwSetWindowIcon(window, 1, &(GLFWimage){16, 16, (unsigned char*)&icon_image.pixel_data});
 
-    // hide cursor
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+    // hide cursor, the benchmark flies itself
+    if(bench > 0)
+        focus_cursor = 0;
+    else
+        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
 
 //*************************************
 // projection
@@ -1528,69 +1747,8 @@ int main(int argc, char** argv)
 // bind vertex and index buffers
 //*************************************
 
-    // ***** BIND FACE *****
-    esBind(GL_ARRAY_BUFFER, &mdlFace.vid, face_vertices, sizeof(face_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlFace.nid, face_normals, sizeof(face_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlFace.iid, face_indices, sizeof(face_indices), GL_STATIC_DRAW);
-
-    // ***** BIND BODY *****
-    esBind(GL_ARRAY_BUFFER, &mdlBody.vid, body_vertices, sizeof(body_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlBody.nid, body_normals, sizeof(body_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlBody.iid, body_indices, sizeof(body_indices), GL_STATIC_DRAW);
-
-    // ***** BIND ARMS *****
-    esBind(GL_ARRAY_BUFFER, &mdlArms.vid, arms_vertices, sizeof(arms_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlArms.nid, arms_normals, sizeof(arms_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlArms.iid, arms_indices, sizeof(arms_indices), GL_STATIC_DRAW);
-
-    // ***** BIND LEFT FLAME *****
-    esBind(GL_ARRAY_BUFFER, &mdlLeftFlame.vid, left_flame_vertices, sizeof(left_flame_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlLeftFlame.nid, left_flame_normals, sizeof(left_flame_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlLeftFlame.iid, left_flame_indices, sizeof(left_flame_indices), GL_STATIC_DRAW);
-
-    // ***** BIND RIGHT FLAME *****
-    esBind(GL_ARRAY_BUFFER, &mdlRightFlame.vid, right_flame_vertices, sizeof(right_flame_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlRightFlame.nid, right_flame_normals, sizeof(right_flame_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRightFlame.iid, right_flame_indices, sizeof(right_flame_indices), GL_STATIC_DRAW);
-
-    // ***** BIND LEGS *****
-    esBind(GL_ARRAY_BUFFER, &mdlLegs.vid, legs_vertices, sizeof(legs_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlLegs.nid, legs_normals, sizeof(legs_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlLegs.iid, legs_indices, sizeof(legs_indices), GL_STATIC_DRAW);
-
-    // ***** BIND FUEL *****
-    esBind(GL_ARRAY_BUFFER, &mdlFuel.vid, fuel_vertices, sizeof(fuel_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlFuel.nid, fuel_normals, sizeof(fuel_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlFuel.iid, fuel_indices, sizeof(fuel_indices), GL_STATIC_DRAW);
-
-    // ***** BIND SHIELD *****
-    esBind(GL_ARRAY_BUFFER, &mdlShield.vid, shield_vertices, sizeof(shield_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlShield.nid, shield_normals, sizeof(shield_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlShield.iid, shield_indices, sizeof(shield_indices), GL_STATIC_DRAW);
-
-    // ***** BIND P-BREAK *****
-    esBind(GL_ARRAY_BUFFER, &mdlPbreak.vid, pbreak_vertices, sizeof(pbreak_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlPbreak.nid, pbreak_normals, sizeof(pbreak_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPbreak.iid, pbreak_indices, sizeof(pbreak_indices), GL_STATIC_DRAW);
-
-    // ***** BIND P-SHIELD *****
-    esBind(GL_ARRAY_BUFFER, &mdlPshield.vid, pshield_vertices, sizeof(pshield_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlPshield.nid, pshield_normals, sizeof(pshield_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPshield.iid, pshield_indices, sizeof(pshield_indices), GL_STATIC_DRAW);
-
-    // ***** BIND P-SLOW *****
-    esBind(GL_ARRAY_BUFFER, &mdlPslow.vid, pslow_vertices, sizeof(pslow_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlPslow.nid, pslow_normals, sizeof(pslow_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPslow.iid, pslow_indices, sizeof(pslow_indices), GL_STATIC_DRAW);
-
-    // ***** BIND P-REPEL *****
-    esBind(GL_ARRAY_BUFFER, &mdlPrepel.vid, prepel_vertices, sizeof(prepel_vertices), GL_STATIC_DRAW);
-    esBind(GL_ARRAY_BUFFER, &mdlPrepel.nid, prepel_normals, sizeof(prepel_normals), GL_STATIC_DRAW);
-    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlPrepel.iid, prepel_indices, sizeof(prepel_indices), GL_STATIC_DRAW);
-
-    
-    /// ---
-
+    // ***** BIND PLAYER *****
+    bindPlayer();
 
     // ***** BIND ROCK1 *****
     esBind(GL_ARRAY_BUFFER, &mdlRock[0].vid, rock1_vertices, sizeof(rock1_vertices), GL_STATIC_DRAW);
@@ -1646,13 +1804,150 @@ int main(int argc, char** argv)
     esBind(GL_ARRAY_BUFFER, &mdlRock[8].cid, rock9_colors, sizeof(rock9_colors), GL_STATIC_DRAW);
     esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRock[8].iid, rock9_indices, sizeof(rock9_indices), GL_STATIC_DRAW);
 
+    // ***** BIND ROCK LODS *****
+    // assets/lod.c, half & a quarter of the triangles, flat shaded like the full meshes
+    for(uint j = 0; j < 9; j++)
+        rock_numind[0][j] = rock1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][0].vid, rock1_lod1_vertices, sizeof(rock1_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][0].nid, rock1_lod1_normals, sizeof(rock1_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][0].cid, rock1_lod1_colors, sizeof(rock1_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][0].iid, rock1_lod1_indices, sizeof(rock1_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][0] = rock1_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][1].vid, rock2_lod1_vertices, sizeof(rock2_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][1].nid, rock2_lod1_normals, sizeof(rock2_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][1].cid, rock2_lod1_colors, sizeof(rock2_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][1].iid, rock2_lod1_indices, sizeof(rock2_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][1] = rock2_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][2].vid, rock3_lod1_vertices, sizeof(rock3_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][2].nid, rock3_lod1_normals, sizeof(rock3_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][2].cid, rock3_lod1_colors, sizeof(rock3_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][2].iid, rock3_lod1_indices, sizeof(rock3_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][2] = rock3_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][3].vid, rock4_lod1_vertices, sizeof(rock4_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][3].nid, rock4_lod1_normals, sizeof(rock4_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][3].cid, rock4_lod1_colors, sizeof(rock4_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][3].iid, rock4_lod1_indices, sizeof(rock4_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][3] = rock4_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][4].vid, rock5_lod1_vertices, sizeof(rock5_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][4].nid, rock5_lod1_normals, sizeof(rock5_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][4].cid, rock5_lod1_colors, sizeof(rock5_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][4].iid, rock5_lod1_indices, sizeof(rock5_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][4] = rock5_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][5].vid, rock6_lod1_vertices, sizeof(rock6_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][5].nid, rock6_lod1_normals, sizeof(rock6_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][5].cid, rock6_lod1_colors, sizeof(rock6_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][5].iid, rock6_lod1_indices, sizeof(rock6_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][5] = rock6_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][6].vid, rock7_lod1_vertices, sizeof(rock7_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][6].nid, rock7_lod1_normals, sizeof(rock7_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][6].cid, rock7_lod1_colors, sizeof(rock7_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][6].iid, rock7_lod1_indices, sizeof(rock7_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][6] = rock7_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][7].vid, rock8_lod1_vertices, sizeof(rock8_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][7].nid, rock8_lod1_normals, sizeof(rock8_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][7].cid, rock8_lod1_colors, sizeof(rock8_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][7].iid, rock8_lod1_indices, sizeof(rock8_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][7] = rock8_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][8].vid, rock9_lod1_vertices, sizeof(rock9_lod1_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][8].nid, rock9_lod1_normals, sizeof(rock9_lod1_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[0][8].cid, rock9_lod1_colors, sizeof(rock9_lod1_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[0][8].iid, rock9_lod1_indices, sizeof(rock9_lod1_indices), GL_STATIC_DRAW);
+    rock_numind[1][8] = rock9_lod1_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][0].vid, rock1_lod2_vertices, sizeof(rock1_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][0].nid, rock1_lod2_normals, sizeof(rock1_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][0].cid, rock1_lod2_colors, sizeof(rock1_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][0].iid, rock1_lod2_indices, sizeof(rock1_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][0] = rock1_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][1].vid, rock2_lod2_vertices, sizeof(rock2_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][1].nid, rock2_lod2_normals, sizeof(rock2_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][1].cid, rock2_lod2_colors, sizeof(rock2_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][1].iid, rock2_lod2_indices, sizeof(rock2_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][1] = rock2_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][2].vid, rock3_lod2_vertices, sizeof(rock3_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][2].nid, rock3_lod2_normals, sizeof(rock3_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][2].cid, rock3_lod2_colors, sizeof(rock3_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][2].iid, rock3_lod2_indices, sizeof(rock3_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][2] = rock3_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][3].vid, rock4_lod2_vertices, sizeof(rock4_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][3].nid, rock4_lod2_normals, sizeof(rock4_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][3].cid, rock4_lod2_colors, sizeof(rock4_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][3].iid, rock4_lod2_indices, sizeof(rock4_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][3] = rock4_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][4].vid, rock5_lod2_vertices, sizeof(rock5_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][4].nid, rock5_lod2_normals, sizeof(rock5_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][4].cid, rock5_lod2_colors, sizeof(rock5_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][4].iid, rock5_lod2_indices, sizeof(rock5_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][4] = rock5_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][5].vid, rock6_lod2_vertices, sizeof(rock6_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][5].nid, rock6_lod2_normals, sizeof(rock6_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][5].cid, rock6_lod2_colors, sizeof(rock6_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][5].iid, rock6_lod2_indices, sizeof(rock6_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][5] = rock6_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][6].vid, rock7_lod2_vertices, sizeof(rock7_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][6].nid, rock7_lod2_normals, sizeof(rock7_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][6].cid, rock7_lod2_colors, sizeof(rock7_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][6].iid, rock7_lod2_indices, sizeof(rock7_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][6] = rock7_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][7].vid, rock8_lod2_vertices, sizeof(rock8_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][7].nid, rock8_lod2_normals, sizeof(rock8_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][7].cid, rock8_lod2_colors, sizeof(rock8_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][7].iid, rock8_lod2_indices, sizeof(rock8_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][7] = rock8_lod2_numind;
+
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][8].vid, rock9_lod2_vertices, sizeof(rock9_lod2_vertices), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][8].nid, rock9_lod2_normals, sizeof(rock9_lod2_normals), GL_STATIC_DRAW);
+    esBind(GL_ARRAY_BUFFER, &mdlRockLod[1][8].cid, rock9_lod2_colors, sizeof(rock9_lod2_colors), GL_STATIC_DRAW);
+    esBind(GL_ELEMENT_ARRAY_BUFFER, &mdlRockLod[1][8].iid, rock9_lod2_indices, sizeof(rock9_lod2_indices), GL_STATIC_DRAW);
+    rock_numind[2][8] = rock9_lod2_numind;
+
+    // ***** VERTEX ARRAYS *****
+    // built once, binding a model is then one call (GL 3.0, else nothing happens)
+    for(uint i = 0; i < 9; i++)
+    {
+        esModelVAO(&mdlRock[i]);
+        for(uint l = 0; l < ROCK_LODS-1; l++)
+            esModelVAO(&mdlRockLod[l][i]);
+    }
+    esModelVAO(&mdlPlayer);
+
+    // ***** ROCK COLOUR SLOTS *****
+    // filled a rock at a time by rockColorSlot()
+    esBind(GL_ARRAY_BUFFER, &rock_colors_id, NULL, sizeof(rock1_colors)*color_slots, GL_DYNAMIC_DRAW);
+
+    // ***** INSTANCE STREAM *****
+    if(instanced == 1)
+        esBind(GL_ARRAY_BUFFER, &inst_vbo, NULL, ARRAY_MAX*8*sizeof(f32), GL_STREAM_DRAW);
+
+    // ***** IMPOSTOR STREAM *****
+    esBind(GL_ARRAY_BUFFER, &imp_vbo, NULL, ARRAY_MAX*8*sizeof(f32), GL_STREAM_DRAW);
+
 //*************************************
 // compile & link shader programs
 //*************************************
 
     //makeAllShaders();
-    makeLambert1();
-    makeLambert3();
+    makeLambert1P();
+    makeLambert3I();
+    makeLambert3N();
+    makeImpostor();
+    makeNormal();
 
 //*************************************
 // configure render options
@@ -1661,37 +1956,87 @@ int main(int argc, char** argv)
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glEnable(GL_CULL_FACE);
     glEnable(GL_DEPTH_TEST);
+    glEnable(GL_VERTEX_PROGRAM_POINT_SIZE); // always on in OpenGL ES
+    glEnable(GL_POINT_SPRITE);
     glClearColor(0.0, 0.0, 0.0, 0.0);
 
+    if(impostors == 1)
+        bakeImpostors();
+
 //*************************************
 // execute update / render loop
 //*************************************
 
     // init
-    newGame(NEWGAME_SEED);
+    poolInit(0);
+    simNew(NEWGAME_SEED, t);
+    uSnapshot();
+    printf("Asteroids: %u, Far Distance: %g, Colour Radius: %g, Sectors: %u\n", ARRAY_MAX, FAR_DISTANCE, color_radius, w.sectors);
+    printf("Memory: %.1f MB world, %.1f MB snapshots, %.1f MB render, %.1f MB GPU colours + %.1f MB GPU streams\n", sim_bytes()/1048576.0, snapBytes()/1048576.0, render_bytes/1048576.0,
+           sizeof(rock1_colors)*color_slots/1048576.0, ARRAY_MAX*8*sizeof(f32)*(1+instanced)/1048576.0);
+    printf("SIMD: %s, asteroid step %s, model-view batch %s\n", cpuName(), step_kernel, mKernel());
 
     // reset
     t = glfwGetTime();
     lfct = t;
+    if(simthread == 1)
+    {
+        // split the CPUs so neither thread's jobs queue behind the other's
+        const unsigned int cpus = poolThreads();
+        if(cpus > 1)
+        {
+            poolQuit();
+            poolInit(cpus - cpus/2);
+            poolStart(&stage_pool, cpus/2);
+            poolUse(&stage_pool);
+        }
+        if(pthread_create(&sim_thread, NULL, simMain, NULL) != 0)
+        {
+            simthread = 0;
+            poolUse(&workers);
+            poolStop(&stage_pool);
+            poolQuit();
+            poolInit(cpus);
+        }
+    }
     
     // event loop
+    const double bst = telNow();
     while(!glfwWindowShouldClose(window))
     {
-        t = glfwGetTime();
+        telFrame();
         glfwPollEvents();
+        t = glfwGetTime(); // after the events so the sim on this thread takes them this frame
+        if(bench > 0){benchInput();}
         main_loop();
+        telEnd();
         fc++;
+        if(bench > 0 && ++bench_frame >= bench){break;}
     }
 
     // end
+    if(simthread == 1)
+    {
+        __atomic_store_n(&sim_quit, 1, __ATOMIC_RELEASE);
+        pthread_join(sim_thread, NULL);
+    }
     timeTaken(0);
     char strts[16];
     timestamp(&strts[0]);
-    printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, pf, pb, ps, psl, pre, pm);
+    if(simthread == 1)
+        printf("[%s] Sim thread waited %.1f ms on the renderer\n", strts, snapWaited()*1e3);
+    printf("[%s] Stats: Fuel %.2f - Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f - Mined %u\n", strts, w.pf, w.pb, w.ps, w.psl, w.pre, w.pm);
     printf("[%s] Time-Taken: %s or %g Seconds\n", strts, tts, t-st);
     printf("[%s] Game End.\n\n", strts);
+    telReport();
+    if(telCSV("frametimes.csv") == 1)
+        printf("[%s] Frame times written to frametimes.csv\n", strts);
+    if(bench > 0)
+        benchReport(telNow()-bst, msaa);
 
     // done
+    poolStop(&stage_pool);
+    poolQuit();
     glfwDestroyWindow(window);
     glfwTerminate();
     exit(EXIT_SUCCESS);
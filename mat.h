@@ -4,13 +4,23 @@
     Requires vec.h: https://gist.github.com/mrbid/77a92019e1ab8b86109bf103166bd04e
 
     Credits:
-    Aaftab Munshi, Dan Ginsburg, Dave Shreiner, James William Fletcher, Intel, Gabriel Cramer
+    Aaftab Munshi, Dan Ginsburg, Dave Shreiner, James William Fletcher, Intel, Gabriel Cramer, Julien Pommier (sincos_ps)
+
+    Batch:
+    mModelViewN() builds N model-view matrices from SoA arrays in one pass,
+    using GCC vector extensions 8 wide when built for AVX2 and 4 wide
+    otherwise. The 4 wide loop is built for AVX2+FMA, for NEON on 32-bit
+    ARM builds that target VFP only, and for SSE2/NEON, and the first call
+    binds the best one the CPU has (cpu.h), mKernel() names it. #define
+    MAT_SCALAR to force the scalar path which is just mModelView() in a
+    loop.
 */
 
 #ifndef MAT_H
 #define MAT_H
 
 #include "vec.h"
+#include "cpu.h"
 
 typedef struct
 {
@@ -40,6 +50,11 @@ void mGetDirX(vec *r, const mat matrix);
 void mGetDirY(vec *r, const mat matrix);
 void mGetDirZ(vec *r, const mat matrix);
 
+// r = view * translate(x,y,z) * mRotY(ry) * mRotZ(rz) * mRotX(rx) * scale(s)
+void mModelView(mat *r, const mat *view, const float x, const float y, const float z, const float s, const float rx, const float ry, const float rz);
+void mModelViewN(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n); // rx, ry or rz can be NULL for no rotation
+const char* mKernel(); // the mModelViewN() kernel bound for this CPU
+
 //
 
 void mIdent(mat *m)
@@ -490,4 +505,174 @@ void mGetDirZ(vec *r, const mat matrix)
     r->z = matrix.m[2][2];
 }
 
+void mModelView(mat *r, const mat *view, const float x, const float y, const float z, const float s, const float rx, const float ry, const float rz)
+{
+    mat model;
+    mIdent(&model);
+    mTranslate(&model, x, y, z);
+    mRotY(&model, ry);
+    mRotZ(&model, rz);
+    mRotX(&model, rx);
+    mScale(&model, s, s, s);
+    mMul(r, &model, view);
+}
+
+#if defined(__GNUC__) && !defined(MAT_SCALAR)
+
+#ifdef __AVX2__
+    #define MAT_LANES 8
+#else
+    #define MAT_LANES 4
+#endif
+typedef float mvf __attribute__((vector_size(MAT_LANES*4)));
+typedef int   mvi __attribute__((vector_size(MAT_LANES*4)));
+
+static inline mvf mLoadV(const float* p)
+{
+    mvf r;
+    memcpy(&r, p, sizeof(mvf));
+    return r;
+}
+
+// cephes style sincos, adapted from sse_mathfun.h sincos_ps() by Julien Pommier
+static inline void mSinCosV(const mvf xin, mvf* s, mvf* c)
+{
+    const mvi sign = (mvi){0} + (int)0x80000000;
+    mvf x = xin;
+    mvi sign_sin = (mvi)x & sign;
+    x = (mvf)((mvi)x & ~sign);
+
+    mvi j = __builtin_convertvector(x * 1.27323954473516f, mvi); // 4 / PI
+    j = (j + 1) & ~1;
+    const mvf y = __builtin_convertvector(j, mvf);
+
+    const mvi swap_sin = (j & 4) << 29;
+    const mvi sign_cos = (~(j - 2) & 4) << 29;
+    const mvi poly = (j & 2) == 0;
+    sign_sin ^= swap_sin;
+
+    x = ((x - y * 0.78515625f) - y * 2.4187564849853515625e-4f) - y * 3.77489497744594108e-8f;
+
+    const mvf z = x * x;
+    mvf y1 = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z;
+    y1 = y1 - z * 0.5f + 1.f;
+    mvf y2 = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * x;
+    y2 = y2 + x;
+
+    const mvi ys = ((mvi)y2 & poly) | ((mvi)y1 & ~poly);
+    const mvi yc = ((mvi)y1 & poly) | ((mvi)y2 & ~poly);
+    *s = (mvf)(ys ^ sign_sin);
+    *c = (mvf)(yc ^ sign_cos);
+}
+
+static inline __attribute__((always_inline)) void mModelViewLanes(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n)
+{
+    const mvf zero = (mvf){0};
+    const mvf one = zero + 1.f;
+
+    unsigned int i = 0;
+    for(; i + MAT_LANES <= n; i += MAT_LANES)
+    {
+        mvf sx = zero, cx = one, sy = zero, cy = one, sz = zero, cz = one;
+        if(rx != NULL){mSinCosV(mLoadV(rx+i), &sx, &cx);}
+        if(ry != NULL){mSinCosV(mLoadV(ry+i), &sy, &cy);}
+        if(rz != NULL){mSinCosV(mLoadV(rz+i), &sz, &cz);}
+
+        // rotation in [row][col] form: Ry * Rz * Rx as mRotY/mRotZ/mRotX define them
+        const mvf yz00 = cz,      yz01 = sz,      yz02 = zero;
+        const mvf yz10 = -cy*sz,  yz11 = cy*cz,   yz12 = sy;
+        const mvf yz20 = sy*sz,   yz21 = -sy*cz,  yz22 = cy;
+        const mvf sc = mLoadV(s+i);
+        mvf m[3][3];
+        m[0][0] = (yz00*cx + yz02*sx) * sc; m[0][1] = yz01 * sc; m[0][2] = (yz02*cx - yz00*sx) * sc;
+        m[1][0] = (yz10*cx + yz12*sx) * sc; m[1][1] = yz11 * sc; m[1][2] = (yz12*cx - yz10*sx) * sc;
+        m[2][0] = (yz20*cx + yz22*sx) * sc; m[2][1] = yz21 * sc; m[2][2] = (yz22*cx - yz20*sx) * sc;
+        const mvf t[3] = {mLoadV(x+i), mLoadV(y+i), mLoadV(z+i)};
+
+        // view * model, view->m[col][row]
+        for(int row = 0; row < 4; row++)
+        {
+            const float v0 = view->m[0][row], v1 = view->m[1][row], v2 = view->m[2][row], v3 = view->m[3][row];
+            mvf o[4];
+            for(int col = 0; col < 3; col++)
+                o[col] = v0*m[0][col] + v1*m[1][col] + v2*m[2][col];
+            o[3] = v0*t[0] + v1*t[1] + v2*t[2] + v3;
+            for(int k = 0; k < MAT_LANES; k++)
+            {
+                r[i+k].m[0][row] = o[0][k];
+                r[i+k].m[1][row] = o[1][k];
+                r[i+k].m[2][row] = o[2][k];
+                r[i+k].m[3][row] = o[3][k];
+            }
+        }
+    }
+    for(; i < n; i++)
+        mModelView(&r[i], view, x[i], y[i], z[i], s[i], rx ? rx[i] : 0.f, ry ? ry[i] : 0.f, rz ? rz[i] : 0.f);
+}
+
+typedef void (*mmodelviewn)(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n);
+static void mModelViewBind(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n);
+mmodelviewn mat_modelviewn = mModelViewBind;
+const char* mat_kernel = NULL;
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(__AVX2__)
+__attribute__((target("avx2,fma"))) static void mModelViewAVX2(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n){mModelViewLanes(r, view, x, y, z, s, rx, ry, rz, n);}
+#endif
+#ifdef CPU_NEON_TARGET
+__attribute__((target("fpu=neon"))) static void mModelViewNEON(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n){mModelViewLanes(r, view, x, y, z, s, rx, ry, rz, n);}
+#endif
+static void mModelViewVector(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n){mModelViewLanes(r, view, x, y, z, s, rx, ry, rz, n);}
+
+const char* mKernel()
+{
+    if(mat_kernel != NULL)
+        return mat_kernel;
+    mat_modelviewn = mModelViewVector;
+#ifdef __AVX2__
+    mat_kernel = "avx2 x8";
+#elif defined(__x86_64__) || defined(__i386__)
+    mat_kernel = "sse2";
+    if((cpuFeatures() & (CPU_AVX2|CPU_FMA)) == (CPU_AVX2|CPU_FMA))
+    {
+        mat_modelviewn = mModelViewAVX2;
+        mat_kernel = "avx2";
+    }
+#elif defined(__ARM_NEON)
+    mat_kernel = "neon";
+#elif defined(CPU_NEON_TARGET)
+    mat_kernel = "vector";
+    if(cpuFeatures() & CPU_NEON)
+    {
+        mat_modelviewn = mModelViewNEON;
+        mat_kernel = "neon";
+    }
+#else
+    mat_kernel = "vector";
+#endif
+    return mat_kernel;
+}
+
+static void mModelViewBind(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n)
+{
+    mKernel();
+    mat_modelviewn(r, view, x, y, z, s, rx, ry, rz, n);
+}
+
+void mModelViewN(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n)
+{
+    mat_modelviewn(r, view, x, y, z, s, rx, ry, rz, n);
+}
+
+#else
+
+void mModelViewN(mat *r, const mat *view, const float *x, const float *y, const float *z, const float *s, const float *rx, const float *ry, const float *rz, const unsigned int n)
+{
+    for(unsigned int i = 0; i < n; i++)
+        mModelView(&r[i], view, x[i], y[i], z[i], s[i], rx ? rx[i] : 0.f, ry ? ry[i] : 0.f, rz ? rz[i] : 0.f);
+}
+
+const char* mKernel(){return "scalar";}
+
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+    Offscreen backend, build with -DOFFSCREEN and link -lEGL instead of -lglfw.
+
+    Implements the GLFW calls main.c makes on top of an EGL surfaceless
+    context (Mesa, llvmpipe works) rendering into an FBO, so the real
+    render path runs on machines with no display. There is no input,
+    the window "closes" after offscreen_frames frames and every
+    offscreen_ppm-th frame is written out as frame_NNNNN.ppm.
+
+    glfwSwapBuffers() calls glFinish() so frame times include the work
+    the driver would otherwise queue up.
+*/
+
+#ifndef OFFSCREEN_H
+#define OFFSCREEN_H
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+unsigned int offscreen_frames = 600; // --frames=n, 0 runs until killed
+unsigned int offscreen_ppm = 0;      // --ppm=n, write every n-th frame
+
+//*************************************
+// implementation
+//*************************************
+typedef struct
+{
+    EGLDisplay display;
+    EGLContext context;
+    GLuint fbo, color, depth;    // render target, multisampled if asked for
+    GLuint rfbo, rcolor;         // single sample resolve target
+    int width, height;
+    int samples;
+    unsigned int frame;
+    int close;
+    unsigned char* pixels;
+    GLFWvidmode mode;
+} offscreen;
+offscreen os = {0};
+
+// the context is not current when glad loads, so the FBO setup fetches its own
+PFNGLGENFRAMEBUFFERSPROC os_glGenFramebuffers;
+PFNGLBINDFRAMEBUFFERPROC os_glBindFramebuffer;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC os_glFramebufferRenderbuffer;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC os_glCheckFramebufferStatus;
+PFNGLGENRENDERBUFFERSPROC os_glGenRenderbuffers;
+PFNGLBINDRENDERBUFFERPROC os_glBindRenderbuffer;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC os_glRenderbufferStorageMultisample;
+PFNGLGETINTEGERVPROC os_glGetIntegerv;
+
+static GLuint osRenderbuffer(GLenum format, int samples)
+{
+    GLuint id;
+    os_glGenRenderbuffers(1, &id);
+    os_glBindRenderbuffer(GL_RENDERBUFFER, id);
+    os_glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, format, os.width, os.height);
+    return id;
+}
+
+static int osTarget()
+{
+    os_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)eglGetProcAddress("glGenFramebuffers");
+    os_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)eglGetProcAddress("glBindFramebuffer");
+    os_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)eglGetProcAddress("glFramebufferRenderbuffer");
+    os_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)eglGetProcAddress("glCheckFramebufferStatus");
+    os_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)eglGetProcAddress("glGenRenderbuffers");
+    os_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)eglGetProcAddress("glBindRenderbuffer");
+    os_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)eglGetProcAddress("glRenderbufferStorageMultisample");
+    os_glGetIntegerv = (PFNGLGETINTEGERVPROC)eglGetProcAddress("glGetIntegerv");
+    if(os_glGenFramebuffers == NULL || os_glRenderbufferStorageMultisample == NULL)
+        return 0;
+
+    GLint max_samples = 0;
+    os_glGetIntegerv(GL_MAX_SAMPLES, &max_samples);
+    if(os.samples > max_samples){os.samples = max_samples;}
+
+    os_glGenFramebuffers(1, &os.fbo);
+    os_glBindFramebuffer(GL_FRAMEBUFFER, os.fbo);
+    os.color = osRenderbuffer(GL_RGBA8, os.samples);
+    os.depth = osRenderbuffer(GL_DEPTH_COMPONENT24, os.samples);
+    os_glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, os.color);
+    os_glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, os.depth);
+    if(os_glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        return 0;
+
+    if(os.samples > 0)
+    {
+        os_glGenFramebuffers(1, &os.rfbo);
+        os_glBindFramebuffer(GL_FRAMEBUFFER, os.rfbo);
+        os.rcolor = osRenderbuffer(GL_RGBA8, 0);
+        os_glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, os.rcolor);
+        if(os_glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            return 0;
+        os_glBindFramebuffer(GL_FRAMEBUFFER, os.fbo);
+    }
+    else
+        os.rfbo = os.fbo;
+    return 1;
+}
+
+static void osWritePPM()
+{
+    if(os.pixels == NULL)
+        os.pixels = malloc(os.width*os.height*3);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, os.rfbo);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, os.width, os.height, GL_RGB, GL_UNSIGNED_BYTE, os.pixels);
+    glBindFramebuffer(GL_FRAMEBUFFER, os.fbo);
+
+    char name[32];
+    sprintf(name, "frame_%05u.ppm", os.frame);
+    FILE* f = fopen(name, "wb");
+    if(f == NULL)
+        return;
+    fprintf(f, "P6\n%i %i\n255\n", os.width, os.height);
+    for(int y = os.height-1; y >= 0; y--) // GL rows are bottom up
+        fwrite(&os.pixels[y*os.width*3], 1, os.width*3, f);
+    fclose(f);
+}
+
+//*************************************
+// glfw
+//*************************************
+int glfwInit(void)
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if(getPlatformDisplay != NULL)
+        os.display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    if(os.display == EGL_NO_DISPLAY)
+        os.display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if(os.display == EGL_NO_DISPLAY || eglInitialize(os.display, NULL, NULL) == EGL_FALSE)
+    {
+        printf("Offscreen: no EGL display.\n");
+        return GLFW_FALSE;
+    }
+    if(eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+    {
+        printf("Offscreen: EGL has no desktop OpenGL.\n");
+        return GLFW_FALSE;
+    }
+    return GLFW_TRUE;
+}
+
+void glfwTerminate(void)
+{
+    if(os.display == EGL_NO_DISPLAY)
+        return;
+    eglMakeCurrent(os.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if(os.context != EGL_NO_CONTEXT)
+        eglDestroyContext(os.display, os.context);
+    eglTerminate(os.display);
+    free(os.pixels);
+    os.display = EGL_NO_DISPLAY;
+}
+
+void glfwWindowHint(int hint, int value)
+{
+    if(hint == GLFW_SAMPLES)
+        os.samples = value;
+}
+
+GLFWwindow* glfwCreateWindow(int width, int height, const char* title, GLFWmonitor* monitor, GLFWwindow* share)
+{
+    os.width = width;
+    os.height = height;
+    os.mode = (GLFWvidmode){width, height, 8, 8, 8, 60};
+
+    // surfaceless needs no config, else take the first one that can render GL
+    EGLConfig config = (EGLConfig)0;
+    const char* ext = eglQueryString(os.display, EGL_EXTENSIONS);
+    if(ext == NULL || strstr(ext, "EGL_KHR_no_config_context") == NULL)
+    {
+        const EGLint attribs[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE};
+        EGLint n = 0;
+        if(eglChooseConfig(os.display, attribs, &config, 1, &n) == EGL_FALSE || n == 0)
+            return NULL;
+    }
+    os.context = eglCreateContext(os.display, config, EGL_NO_CONTEXT, NULL);
+    if(os.context == EGL_NO_CONTEXT)
+    {
+        printf("Offscreen: could not create an OpenGL context.\n");
+        return NULL;
+    }
+    return (GLFWwindow*)&os;
+}
+
+void glfwDestroyWindow(GLFWwindow* window){}
+
+void glfwMakeContextCurrent(GLFWwindow* window)
+{
+    if(eglMakeCurrent(os.display, EGL_NO_SURFACE, EGL_NO_SURFACE, os.context) == EGL_FALSE || osTarget() == 0)
+    {
+        printf("Offscreen: could not make the render target.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+GLFWglproc glfwGetProcAddress(const char* procname)
+{
+    return (GLFWglproc)eglGetProcAddress(procname);
+}
+
+int glfwExtensionSupported(const char* extension)
+{
+    GLint n = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &n);
+    for(GLint i = 0; i < n; i++)
+        if(strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), extension) == 0)
+            return GLFW_TRUE;
+    return GLFW_FALSE;
+}
+
+void glfwSwapBuffers(GLFWwindow* window)
+{
+    if(os.rfbo != os.fbo)
+    {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, os.fbo);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, os.rfbo);
+        glBlitFramebuffer(0, 0, os.width, os.height, 0, 0, os.width, os.height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, os.fbo);
+    }
+    if(offscreen_ppm > 0 && os.frame % offscreen_ppm == offscreen_ppm-1)
+        osWritePPM();
+    glFinish();
+
+    os.frame++;
+    if(offscreen_frames > 0 && os.frame >= offscreen_frames)
+        os.close = 1;
+}
+
+int glfwWindowShouldClose(GLFWwindow* window)
+{
+    return os.close;
+}
+
+double glfwGetTime(void)
+{
+    static double start = -1.0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const double n = (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+    if(start < 0.0){start = n;}
+    return n - start;
+}
+
+// no display, so no input & nothing to show
+void glfwPollEvents(void){}
+void glfwSwapInterval(int interval){}
+GLFWmonitor* glfwGetPrimaryMonitor(void){return (GLFWmonitor*)&os;}
+const GLFWvidmode* glfwGetVideoMode(GLFWmonitor* monitor){return &os.mode;}
+void glfwSetWindowPos(GLFWwindow* window, int xpos, int ypos){}
+void glfwSetWindowTitle(GLFWwindow* window, const char* title){}
+void glfwSetWindowIcon(GLFWwindow* window, int count, const GLFWimage* images){}
+void glfwSetInputMode(GLFWwindow* window, int mode, int value){}
+void glfwGetCursorPos(GLFWwindow* window, double* xpos, double* ypos){*xpos = os.width/2; *ypos = os.height/2;}
+void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos){}
+GLFWwindowsizefun glfwSetWindowSizeCallback(GLFWwindow* window, GLFWwindowsizefun callback){return NULL;}
+GLFWkeyfun glfwSetKeyCallback(GLFWwindow* window, GLFWkeyfun callback){return NULL;}
+GLFWmousebuttonfun glfwSetMouseButtonCallback(GLFWwindow* window, GLFWmousebuttonfun callback){return NULL;}
+GLFWscrollfun glfwSetScrollCallback(GLFWwindow* window, GLFWscrollfun callback){return NULL;}
+
+#endif
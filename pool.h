@@ -0,0 +1,196 @@
+/*
+    Minimal pthread worker pool.
+
+    poolRun() splits [0,n) into one contiguous block per thread, the
+    calling thread runs the first block itself, and returns once every
+    block is done. Work written per index needs no locking and gives the
+    same result for any thread count.
+
+    A pool serves one calling thread at a time. poolRun() runs on the
+    pool the calling thread picked with poolUse(), the global workers
+    pool until it does, so two threads that both fan out (the sim and
+    the renderer) each start their own pool and never wait on the other.
+
+    poolInit(0) uses one thread per online CPU.
+*/
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define POOL_MAX 64
+
+typedef void (*poolfn)(void* arg, unsigned int start, unsigned int end);
+typedef struct pool pool;
+
+void poolInit(unsigned int threads);
+void poolRun(poolfn fn, void* arg, unsigned int n);
+unsigned int poolThreads();
+void poolQuit();
+
+void poolStart(pool* p, unsigned int threads);
+void poolUse(pool* p); // for poolRun() on the calling thread
+void poolStop(pool* p);
+unsigned int poolCPUs();
+
+//*************************************
+// implementation
+//*************************************
+typedef struct
+{
+    pool* p;
+    unsigned int t;
+} poolslot;
+
+struct pool
+{
+    pthread_t thread[POOL_MAX];
+    poolslot slot[POOL_MAX];
+    pthread_mutex_t lock;
+    pthread_cond_t go;
+    pthread_cond_t done;
+    unsigned int threads; // including the caller
+    unsigned int job;     // bumped for every poolRun()
+    unsigned int pending;
+    unsigned int quit;
+
+    poolfn fn;
+    void* arg;
+    unsigned int n;
+};
+pool workers = {0};
+static __thread pool* pool_self = &workers;
+
+static inline void poolBlock(unsigned int t, unsigned int n, unsigned int threads, unsigned int* start, unsigned int* end)
+{
+    *start = (unsigned int)(((unsigned long long)n * t) / threads);
+    *end = (unsigned int)(((unsigned long long)n * (t+1)) / threads);
+}
+
+static void* poolWorker(void* s)
+{
+    pool* p = ((poolslot*)s)->p;
+    const unsigned int t = ((poolslot*)s)->t;
+    unsigned int seen = 0;
+    pthread_mutex_lock(&p->lock);
+    while(1)
+    {
+        while(p->job == seen && p->quit == 0)
+            pthread_cond_wait(&p->go, &p->lock);
+        if(p->quit == 1)
+            break;
+        seen = p->job;
+        const poolfn fn = p->fn;
+        void* arg = p->arg;
+        unsigned int start, end;
+        poolBlock(t, p->n, p->threads, &start, &end);
+        pthread_mutex_unlock(&p->lock);
+
+        if(start < end)
+            fn(arg, start, end);
+
+        pthread_mutex_lock(&p->lock);
+        if(--p->pending == 0)
+            pthread_cond_signal(&p->done);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+unsigned int poolCPUs()
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? n : 1;
+#else
+    return 4;
+#endif
+}
+
+void poolStart(pool* p, unsigned int threads)
+{
+    if(threads == 0){threads = poolCPUs();}
+    if(threads > POOL_MAX){threads = POOL_MAX;}
+
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->go, NULL);
+    pthread_cond_init(&p->done, NULL);
+    p->threads = 1;
+    p->job = 0; // workers start having seen none, a restarted pool must not rerun its last job
+    for(unsigned int t = 1; t < threads; t++)
+    {
+        p->slot[t].p = p;
+        p->slot[t].t = t;
+        if(pthread_create(&p->thread[t], NULL, poolWorker, &p->slot[t]) != 0)
+            break;
+        p->threads++;
+    }
+}
+
+void poolUse(pool* p)
+{
+    pool_self = p;
+}
+
+void poolStop(pool* p)
+{
+    if(p->threads <= 1)
+        return;
+    pthread_mutex_lock(&p->lock);
+    p->quit = 1;
+    pthread_cond_broadcast(&p->go);
+    pthread_mutex_unlock(&p->lock);
+    for(unsigned int t = 1; t < p->threads; t++)
+        pthread_join(p->thread[t], NULL);
+    p->threads = 1;
+    p->quit = 0;
+}
+
+void poolInit(unsigned int threads)
+{
+    poolStart(&workers, threads);
+}
+
+void poolRun(poolfn fn, void* arg, unsigned int n)
+{
+    pool* p = pool_self;
+    if(p->threads <= 1)
+    {
+        if(n > 0)
+            fn(arg, 0, n);
+        return;
+    }
+
+    pthread_mutex_lock(&p->lock);
+    p->fn = fn;
+    p->arg = arg;
+    p->n = n;
+    p->pending = p->threads-1;
+    p->job++;
+    pthread_cond_broadcast(&p->go);
+    pthread_mutex_unlock(&p->lock);
+
+    unsigned int start, end;
+    poolBlock(0, n, p->threads, &start, &end);
+    if(start < end)
+        fn(arg, start, end);
+
+    pthread_mutex_lock(&p->lock);
+    while(p->pending > 0)
+        pthread_cond_wait(&p->done, &p->lock);
+    pthread_mutex_unlock(&p->lock);
+}
+
+unsigned int poolThreads()
+{
+    return pool_self->threads > 0 ? pool_self->threads : 1;
+}
+
+void poolQuit()
+{
+    poolStop(&workers);
+}
+
+#endif
@@ -0,0 +1,1561 @@
+/*
+    Space Miner simulation.
+
+    Everything that changes the game state lives here and none of it
+    touches GL or GLFW, so it builds into the game (main.c) and into the
+    headless benchmark (headless.c) alike.
+
+    sim_init()  allocates a world for ARRAY_MAX rocks, the rock count and
+                far distance can be set first with sim_option(), from the
+                command line or a config file (sim_config())
+    sim_new()   generates a world from a seed, in parallel on the pool.h
+                workers, the same world for any number of threads
+    sim_colors()generates rock colour arrays, again from the seed alone
+    sim_step()  advances a world by dt given the player input, the game
+                always steps at SIM_HZ and interpolates between steps, the
+                rocks move in runs of STEP_RUN on the pool.h workers, 4 at
+                a time on the widest SIMD the CPU has (SIM_SCALAR or simd=0
+                for one at a time)
+    sim_break() / sim_repel() / sim_stop() are the player actions
+
+    Rocks that get mined are queued in world.mined for the renderer
+    to update their colours, the caller empties it.
+
+    The rocks are split into sectors, rock i is rock i % sector_rocks of
+    the sector in slot i / sector_rocks and is generated from that
+    sector's key alone. Normally one sector is the whole world, with
+    streaming on (stream=1) the slots hold the cube of sectors
+    SECTOR_SPAN either side of the player's, new ones are generated on
+    their own thread as the player nears them and far ones dropped.
+    Sectors that went live are queued in world.loaded like mined rocks.
+
+    Rocks that are not mined away are listed in world.active, loops
+    over the rocks walk that instead of every slot. A mined away slot is
+    not reused on its own, it stays empty until its sector slot takes a
+    new sector, nothing in the game adds single rocks to a live sector.
+
+    Rocks sim_stop() stops fall asleep, they leave world.active and are
+    not integrated until sim_repel() or sim_break() wakes them. Rocks
+    that fell asleep or woke are queued in world.stirred for the renderer.
+*/
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifndef SEIR_RAND
+    #define SEIR_RAND
+#endif
+#include "vec.h"
+#include "pool.h"
+#include "cpu.h"
+
+// same types as the game, GLushort & GLfloat
+#ifndef uint
+    #define uint unsigned short
+#endif
+#ifndef f32
+    #define f32 float
+#endif
+
+//*************************************
+// game vars
+//*************************************
+#define NEWGAME_SEED 1337
+#define SIM_HZ 60
+const f32 SIM_DT = 1.f/SIM_HZ;
+#define THRUST_POWER 0.03f
+#define NECK_ANGLE 0.6f
+#define ROCK_DARKNESS 0.412f
+#define MAX_ROCK_SCALE 12.f
+const f32 RECIP_MAX_ROCK_SCALE = 1.f/(MAX_ROCK_SCALE+10.f);
+#define FUEL_DRAIN_RATE 0.01f
+#define SHIELD_DRAIN_RATE 0.06f
+#define REFINARY_YEILD 0.13f
+#define CLR_CHANCE 0.01f
+#define STEP_RUN 512 // active rocks a worker moves at a time, a multiple of 16 so runs start on cache lines
+
+#ifdef __arm__
+    #define ROCKS_DEFAULT 2048 // 170 Kilobytes of Asteroids
+    #define FAR_DIVISOR 4.f
+#else
+    #define ROCKS_DEFAULT 16384 // 1.4 Megabytes of Asteroids
+    #define FAR_DIVISOR 8.f  // the least the seed picks, it picks 8-12
+#endif
+#define ROCKS_LIMIT 16777216 // rock indices have to stay exact as floats
+
+// world size, set before sim_init() & sim_new()
+unsigned int ARRAY_MAX = ROCKS_DEFAULT; // rock count
+f32 FAR_DISTANCE = 0.f;                 // rocks start within +/- this on each axis, the most it can be from sim_init() until sim_new()
+f32 far_setting = 0.f;                  // far=, 0 picks FAR_DISTANCE from the seed so any rock count has the default density
+unsigned int sim_stream = 0;            // stream=1, sectors around the player instead of one fixed world
+unsigned int sim_simd = 1;              // simd=0, rocks step one at a time instead of 4 lanes at a time
+
+// sector streaming, the resident cube covers what the one sector world would
+#define SECTOR_SPAN 2                   // sectors either side of the player's, 5x5x5 resident
+#define SECTOR_LATENCY 30               // steps from asking for a sector to it going live, whatever the thread timing
+enum {SECTOR_EMPTY, SECTOR_LOADING, SECTOR_LIVE};
+
+typedef struct
+{
+    int x, y, z;        // sector coordinates, centred on x,y,z * sector_size
+    uint64_t key;       // rng key of its rocks
+    unsigned int state;
+    unsigned int due;   // step it goes live on
+    unsigned int job;   // its place in the generation queue
+} sector;
+
+// rock storage is split by access pattern, struct of arrays so the per-frame
+// loop only streams the hot arrays, all of it on the heap sized by ARRAY_MAX
+typedef struct
+{
+    // hot, every frame
+    int* free; // fast free checking, 2 = being mined away
+    f32* scale;
+    vec* pos;
+    vec* lpos; // position before the last step, for render interpolation
+    vec* vel;
+
+    // cold, spin & mining
+    int* sleep;// 1 = stopped & out of world.active, 2 = stopped & still listed until the next compaction
+    int* nores;// no mineral resources
+    uint* rnd;
+    f32* rndf;
+
+    // mineral amounts
+    f32* qshield;
+    f32* qbreak;
+    f32* qslow;
+    f32* qrepel;
+    f32* qfuel;
+
+    // the colour arrays are generated when a rock is close enough to show them
+} gi;
+
+// spatial hash, rocks are linked into buckets by the cell they are in
+#define GRID_CELL 64.f
+#define GRID_BUCKETS_PER_ROCK 4 // rounded up to a power of 2, cells hash into it so the world needs no bounds
+const f32 RECIP_GRID_CELL = 1.f/GRID_CELL;
+
+typedef struct
+{
+    gi rocks;
+
+    // spatial hash
+    unsigned int grid_mask;         // buckets - 1
+    int* grid_head;
+    int* grid_next;
+    int* grid_prev;
+    int* grid_bucket;               // -1 = not in the grid
+    unsigned int* grid_stamp;       // last query that saw this rock, cells can share a bucket
+    unsigned int grid_query;
+    unsigned int* grid_hits;        // gridNear() results
+
+    uint64_t key; // rng key, from the seed
+
+    // sectors
+    sector* sec;
+    unsigned int sectors;           // slots, 1 without streaming
+    unsigned int sector_rocks;      // rocks per slot
+    f32 sector_size;
+    int scx, scy, scz;              // sector the player is in
+    unsigned int sec_dirty;         // sectors to drop or ask for
+    unsigned int step;
+
+    // rocks mined since the caller last emptied this
+    unsigned int* mined;
+    unsigned int mined_num;
+
+    // sector slots gone live since the caller last emptied this
+    unsigned int* loaded;
+    unsigned int loaded_num;
+
+    // rocks with free != 1, woken rocks & sectors that go live append theirs
+    // out of slot order and the next compaction merges them back in order
+    unsigned int* active;
+    unsigned int active_num;
+    unsigned int active_sorted;     // the first this many are in slot order
+    unsigned int active_dirty;      // some went free = 1, to sleep or were appended since the last compaction
+
+    // rocks that fell asleep or woke since the caller last emptied this, can repeat
+    unsigned int* stirred;
+    unsigned int stirred_num;
+
+    // per run of STEP_RUN active rocks, filled by the workers in sim_step()
+    unsigned int* relink;           // rocks to relink in the grid, each run's at run*STEP_RUN
+    unsigned int* run_relink;       // how many
+    f32* run_so;                    // closest rock touching the player, 0 = none
+
+    // player
+    f32 so; // shield on (closest distance)
+    f32 sa; // shield opacity, 0 = not drawn
+    uint ct;// thrust signal
+    f32 pr; // rotation
+    vec pp; // position
+    vec lpp;// position before the last step
+    f32 lpr;// rotation before the last step
+    vec pv; // velocity, per step
+    vec pd; // thust direction
+    f32 lgr;// last good head rotation
+    vec pld;// look direction
+    vec pfd;// face direction
+    f32 pf; // fuel
+    f32 pb; // break
+    f32 ps; // shield
+    f32 psp;// speed
+    f32 psl;// slow
+    f32 pre;// repel
+    uint pm;// mined asteroid count
+} world;
+
+typedef struct
+{
+    uint keys[6]; // A, D, W, S, Shift, Space
+    f32 xrot;     // camera yaw, the head follows it
+} input;
+
+int  sim_option(const char* opt);    // "rocks=n", "far=d", "stream[=0/1]" or "simd=0/1", 0 if it is none of them
+int  sim_config(const char* file, int (*option)(const char*)); // key=value lines through option(), 0 if unreadable
+int  sim_init(world* w);             // 0 if out of memory
+size_t sim_bytes();                  // what sim_init() allocates
+void sim_free(world* w);
+void sim_new(world* w, unsigned int seed);
+void sim_colors(const world* w, unsigned int first, unsigned int n, f32* colors); // 720 floats a rock
+void sim_rock_colors(const world* w, unsigned int i, f32* colors); // one rock on this thread, mined rocks have none
+void sim_key_colors(uint64_t key, unsigned int k, int mined, f32* colors); // rock k of the sector with that key, no world is read
+void sim_step(world* w, input* in, f32 dt);
+void sim_break(world* w);
+void sim_repel(world* w);
+void sim_stop(world* w);
+
+//*************************************
+// utility functions
+//*************************************
+void timestamp(char* ts)
+{
+    const time_t tt = time(0);
+    strftime(ts, 16, "%H:%M:%S", localtime(&tt));
+}
+
+static inline f32 fzero(f32 f)
+{
+    if(f < 0.f){f = 0.f;}
+    return f;
+}
+
+static inline f32 fone(f32 f)
+{
+    if(f > 1.f){f = 1.f;}
+    return f;
+}
+
+static inline f32 fsat(f32 f)
+{
+    if(f < 0.f){f = 0.f;}
+    if(f > 1.f){f = 1.f;}
+    return f;
+}
+
+//*************************************
+// counter based rng
+//*************************************
+// Squares (Widynski 2020), the n-th number of a stream is a pure function of
+// (key, n) so every rock draws from its own stream and can be generated on
+// any thread in any order: counter = rock << 32 | draw
+#define RNG_COLORS 0x80000000u // colour draws start half way into a rock's stream
+#define RNG_MINERALS 6          // mineral draws start after genRock()'s first 6
+
+typedef struct
+{
+    uint64_t key;
+    uint64_t ctr;
+} rng;
+
+static inline uint32_t squares32(const uint64_t ctr, const uint64_t key)
+{
+    uint64_t x, y, z;
+    y = x = ctr * key;
+    z = y + key;
+    x = x*x + y; x = (x >> 32) | (x << 32);
+    x = x*x + z; x = (x >> 32) | (x << 32);
+    x = x*x + y; x = (x >> 32) | (x << 32);
+    return (x*x + z) >> 32;
+}
+
+static inline uint64_t rngMix(uint64_t z)
+{
+    // splitmix64, odd so no counter maps to zero
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return (z ^ (z >> 31)) | 1;
+}
+
+static inline uint64_t rngKey(const unsigned int seed)
+{
+    return rngMix(seed + 0x9E3779B97F4A7C15ULL);
+}
+
+static inline uint64_t sectorKey(const uint64_t key, const int x, const int y, const int z)
+{
+    return rngMix(key ^ ((uint64_t)(uint32_t)x * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)(uint32_t)y * 0xC2B2AE3D27D4EB4FULL) ^ ((uint64_t)(uint32_t)z * 0x165667B19E3779F9ULL));
+}
+
+static inline rng rngStream(const uint64_t key, const unsigned int stream, const unsigned int offset)
+{
+    return (rng){key, ((uint64_t)stream << 32) | offset};
+}
+
+static inline f32 rngFloat(rng* r, const f32 min, const f32 max)
+{
+    return ((f32)(squares32(r->ctr++, r->key) >> 8) * (1.f/16777216.f)) * (max-min) + min;
+}
+
+static inline unsigned int rngUint(rng* r, const unsigned int min, const unsigned int max)
+{
+    return min + (unsigned int)(((uint64_t)squares32(r->ctr++, r->key) * (max-min)) >> 32);
+}
+
+//*************************************
+// spatial hash
+//*************************************
+static inline int gridCell(f32 f)
+{
+    return (int)floorf(f * RECIP_GRID_CELL);
+}
+
+static inline unsigned int gridHash(const world* w, int x, int y, int z)
+{
+    return (((unsigned int)x * 73856093u) ^ ((unsigned int)y * 19349663u) ^ ((unsigned int)z * 83492791u)) & w->grid_mask;
+}
+
+static inline unsigned int gridBucket(const world* w, vec p)
+{
+    return gridHash(w, gridCell(p.x), gridCell(p.y), gridCell(p.z));
+}
+
+void gridReset(world* w)
+{
+    for(unsigned int i = 0; i <= w->grid_mask; i++)
+        w->grid_head[i] = -1;
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        w->grid_bucket[i] = -1, w->grid_stamp[i] = 0;
+    w->grid_query = 0;
+}
+
+void gridInsert(world* w, unsigned int i)
+{
+    const unsigned int b = gridBucket(w, w->rocks.pos[i]);
+    w->grid_prev[i] = -1;
+    w->grid_next[i] = w->grid_head[b];
+    if(w->grid_head[b] >= 0)
+        w->grid_prev[w->grid_head[b]] = i;
+    w->grid_head[b] = i;
+    w->grid_bucket[i] = b;
+}
+
+void gridRemove(world* w, unsigned int i)
+{
+    const int b = w->grid_bucket[i];
+    if(b < 0)
+        return;
+    if(w->grid_prev[i] >= 0)
+        w->grid_next[w->grid_prev[i]] = w->grid_next[i];
+    else
+        w->grid_head[b] = w->grid_next[i];
+    if(w->grid_next[i] >= 0)
+        w->grid_prev[w->grid_next[i]] = w->grid_prev[i];
+    w->grid_bucket[i] = -1;
+}
+
+int uintCmp(const void* a, const void* b)
+{
+    const unsigned int ua = *(const unsigned int*)a, ub = *(const unsigned int*)b;
+    return (ua > ub) - (ua < ub);
+}
+
+// every rock in the buckets covering the box p +/- r into grid_hits, in ascending
+// index order so callers behave exactly like a linear scan, callers still distance test
+unsigned int gridNear(world* w, vec p, f32 r)
+{
+    w->grid_query++;
+    unsigned int n = 0;
+    const int x0 = gridCell(p.x-r), x1 = gridCell(p.x+r);
+    const int y0 = gridCell(p.y-r), y1 = gridCell(p.y+r);
+    const int z0 = gridCell(p.z-r), z1 = gridCell(p.z+r);
+    for(int x = x0; x <= x1; x++)
+    {
+        for(int y = y0; y <= y1; y++)
+        {
+            for(int z = z0; z <= z1; z++)
+            {
+                for(int i = w->grid_head[gridHash(w, x, y, z)]; i >= 0; i = w->grid_next[i])
+                {
+                    if(w->grid_stamp[i] != w->grid_query)
+                    {
+                        w->grid_stamp[i] = w->grid_query;
+                        w->grid_hits[n++] = i;
+                    }
+                }
+            }
+        }
+    }
+    qsort(&w->grid_hits[0], n, sizeof(unsigned int), uintCmp);
+    return n;
+}
+
+//*************************************
+// world generation
+//*************************************
+// shield, break, slow, repel & fuel, all 0 and returns 0 for a rock without any
+static int genMinerals(rng* g, f32* q)
+{
+    if(rngUint(g, 0, 1000) >= 500)
+    {
+        q[0] = q[1] = q[2] = q[3] = q[4] = 0.f;
+        return 0;
+    }
+    for(uint j = 0; j < 5; j++)
+        q[j] = rngFloat(g, 0.f, 1.f);
+    return 1;
+}
+
+// every rock field but free, which says whether the rest can be read
+static void genRock(world* w, unsigned int i)
+{
+    gi* r = &w->rocks;
+    const sector* sc = &w->sec[i / w->sector_rocks];
+    const f32 h = w->sector_size * 0.5f;
+    const vec c = {sc->x * w->sector_size, sc->y * w->sector_size, sc->z * w->sector_size, 0.f};
+    rng g = rngStream(sc->key, i % w->sector_rocks, 0);
+
+    r->scale[i] = rngFloat(&g, 0.1f, MAX_ROCK_SCALE);
+    r->pos[i].x = c.x + rngFloat(&g, -h, h);
+    r->pos[i].y = c.y + rngFloat(&g, -h, h);
+    r->pos[i].z = c.z + rngFloat(&g, -h, h);
+    r->pos[i].w = 0.f;
+    r->lpos[i] = r->pos[i];
+
+    r->rnd[i] = rngUint(&g, 0, 1000);
+    r->rndf[i] = rngFloat(&g, 0.05f, 0.3f);
+
+    f32 q[5];
+    r->nores[i] = genMinerals(&g, &q[0]) == 0; // g is at RNG_MINERALS
+    r->qshield[i] = q[0];
+    r->qbreak[i] = q[1];
+    r->qslow[i] = q[2];
+    r->qrepel[i] = q[3];
+    r->qfuel[i] = q[4];
+
+    // random unit vector, as vRuv()
+    r->vel[i].x = rngFloat(&g, -1.f, 1.f);
+    r->vel[i].y = rngFloat(&g, -1.f, 1.f);
+    r->vel[i].z = rngFloat(&g, -1.f, 1.f);
+    r->vel[i].w = 0.f;
+}
+
+static void genRocks(void* arg, unsigned int start, unsigned int end)
+{
+    world* w = (world*)arg;
+    for(unsigned int i = start; i < end; i++)
+    {
+        genRock(w, i);
+        w->rocks.free[i] = 0;
+        w->rocks.sleep[i] = 0;
+    }
+}
+
+//*************************************
+// active rocks
+//*************************************
+static int activeOrder(const void* a, const void* b)
+{
+    const unsigned int x = *(const unsigned int*)a, y = *(const unsigned int*)b;
+    return (x > y) - (x < y);
+}
+
+// drops the rocks gone free = 1 or to sleep & merges the appended ones back
+// into slot order, so each sector's meshes stay in runs & runs of 4 stay
+// consecutive however long the session, the relink lists are free to merge
+// through as nothing reads them outside sim_step()'s runs & grid update
+static void activeCompact(world* w)
+{
+    gi* r = &w->rocks;
+    unsigned int n = 0, head = 0;
+    for(unsigned int k = 0; k < w->active_num; k++)
+    {
+        if(k == w->active_sorted){head = n;}
+        const unsigned int i = w->active[k];
+        if(r->free[i] == 1)
+            continue;
+        if(r->sleep[i] == 2)
+            r->sleep[i] = 1;
+        else
+            w->active[n++] = i;
+    }
+    if(w->active_sorted >= w->active_num){head = n;}
+
+    if(head < n)
+    {
+        unsigned int* tail = w->relink;
+        unsigned int a = head, b = n - head, o = n;
+        memcpy(tail, &w->active[head], b*sizeof(unsigned int));
+        qsort(tail, b, sizeof(unsigned int), activeOrder);
+        while(b > 0)
+            w->active[--o] = a > 0 && w->active[a-1] > tail[b-1] ? w->active[--a] : tail[--b];
+    }
+    w->active_num = n;
+    w->active_sorted = n;
+    w->active_dirty = 0;
+}
+
+static inline void rockStir(world* w, unsigned int i)
+{
+    if(w->stirred_num < ARRAY_MAX)
+        w->stirred[w->stirred_num++] = i;
+}
+
+// a stopped rock stays where it is until something moves it
+static void rockSleep(world* w, unsigned int i)
+{
+    gi* r = &w->rocks;
+    if(r->sleep[i] != 0)
+        return;
+    r->sleep[i] = 2;
+    r->lpos[i] = r->pos[i];
+    w->active_dirty = 1;
+    rockStir(w, i);
+}
+
+static void rockWake(world* w, unsigned int i)
+{
+    gi* r = &w->rocks;
+    if(r->sleep[i] == 0)
+        return;
+    if(r->sleep[i] == 1)
+    {
+        w->active[w->active_num++] = i;
+        w->active_dirty = 1;
+    }
+    r->sleep[i] = 0;
+    rockStir(w, i);
+}
+
+//*************************************
+// sector streaming
+//*************************************
+// one thread generates the queued sectors in order, their rocks stay free
+// = 1 until the step the sector is due so nothing else reads them meanwhile
+typedef struct
+{
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t go;
+    pthread_cond_t done;
+    world* w;
+    unsigned int* queue; // ring of sector slots, a slot is in it at most once
+    unsigned int head;   // sectors generated
+    unsigned int tail;   // sectors queued
+    unsigned int running;
+    unsigned int quit;
+} streamer;
+streamer streaming = {0};
+
+static void* streamWorker(void* p)
+{
+    world* w = streaming.w;
+    pthread_mutex_lock(&streaming.lock);
+    while(1)
+    {
+        while(streaming.head == streaming.tail && streaming.quit == 0)
+            pthread_cond_wait(&streaming.go, &streaming.lock);
+        if(streaming.quit == 1)
+            break;
+        const unsigned int s = streaming.queue[streaming.head % w->sectors];
+        pthread_mutex_unlock(&streaming.lock);
+
+        const unsigned int first = s * w->sector_rocks;
+        for(unsigned int i = first; i < first + w->sector_rocks; i++)
+            genRock(w, i);
+
+        pthread_mutex_lock(&streaming.lock);
+        streaming.head++;
+        pthread_cond_broadcast(&streaming.done);
+    }
+    pthread_mutex_unlock(&streaming.lock);
+    return NULL;
+}
+
+static int streamStart(world* w)
+{
+    streaming.w = w;
+    streaming.queue = malloc(w->sectors*sizeof(unsigned int));
+    if(streaming.queue == NULL)
+        return 0;
+    streaming.head = streaming.tail = 0;
+    streaming.quit = 0;
+    pthread_mutex_init(&streaming.lock, NULL);
+    pthread_cond_init(&streaming.go, NULL);
+    pthread_cond_init(&streaming.done, NULL);
+    if(pthread_create(&streaming.thread, NULL, streamWorker, NULL) != 0)
+        return 0;
+    streaming.running = 1;
+    return 1;
+}
+
+static void streamStop()
+{
+    if(streaming.running == 1)
+    {
+        pthread_mutex_lock(&streaming.lock);
+        streaming.quit = 1;
+        pthread_cond_signal(&streaming.go);
+        pthread_mutex_unlock(&streaming.lock);
+        pthread_join(streaming.thread, NULL);
+        pthread_mutex_destroy(&streaming.lock);
+        pthread_cond_destroy(&streaming.go);
+        pthread_cond_destroy(&streaming.done);
+        streaming.running = 0;
+    }
+    free(streaming.queue);
+    streaming.queue = NULL;
+}
+
+// blocks until the first jobs sectors queued have been generated
+static void streamWait(unsigned int jobs)
+{
+    if(streaming.running == 0)
+        return;
+    pthread_mutex_lock(&streaming.lock);
+    while(streaming.head < jobs)
+        pthread_cond_wait(&streaming.done, &streaming.lock);
+    pthread_mutex_unlock(&streaming.lock);
+}
+
+static void streamQueue(world* w, unsigned int s, int x, int y, int z)
+{
+    sector* sc = &w->sec[s];
+    sc->x = x, sc->y = y, sc->z = z;
+    sc->key = sectorKey(w->key, x, y, z);
+    sc->state = SECTOR_LOADING;
+    sc->due = w->step + SECTOR_LATENCY;
+
+    pthread_mutex_lock(&streaming.lock);
+    sc->job = streaming.tail;
+    streaming.queue[streaming.tail % w->sectors] = s;
+    streaming.tail++;
+    pthread_cond_signal(&streaming.go);
+    pthread_mutex_unlock(&streaming.lock);
+}
+
+static inline int sectorNear(const world* w, int x, int y, int z)
+{
+    return abs(x - w->scx) <= SECTOR_SPAN && abs(y - w->scy) <= SECTOR_SPAN && abs(z - w->scz) <= SECTOR_SPAN;
+}
+
+// once a step, due sectors go live, then only when the player has changed
+// sector the far ones are dropped & the missing ones asked for
+static void streamStep(world* w)
+{
+    gi* r = &w->rocks;
+    const unsigned int n = w->sector_rocks;
+    w->step++;
+
+    for(unsigned int s = 0; s < w->sectors; s++)
+    {
+        sector* sc = &w->sec[s];
+        if(sc->state != SECTOR_LOADING || sc->due > w->step)
+            continue;
+        streamWait(sc->job+1); // only stalls when the worker is SECTOR_LATENCY steps behind
+        for(unsigned int i = s*n; i < s*n + n; i++)
+        {
+            r->free[i] = 0;
+            r->sleep[i] = 0;
+            gridInsert(w, i);
+            w->active[w->active_num++] = i;
+        }
+        w->active_dirty = 1;
+        sc->state = SECTOR_LIVE;
+        if(w->loaded_num < w->sectors)
+            w->loaded[w->loaded_num++] = s;
+        w->sec_dirty = 1; // the player may have left it behind already
+    }
+
+    const f32 rs = 1.f / w->sector_size;
+    const int x = (int)floorf(w->pp.x*rs + 0.5f);
+    const int y = (int)floorf(w->pp.y*rs + 0.5f);
+    const int z = (int)floorf(w->pp.z*rs + 0.5f);
+    if(x != w->scx || y != w->scy || z != w->scz)
+    {
+        w->scx = x, w->scy = y, w->scz = z;
+        w->sec_dirty = 1;
+    }
+    if(w->sec_dirty == 0)
+        return;
+    w->sec_dirty = 0;
+
+    // drop live sectors out of reach, whatever of them has drifted where
+    for(unsigned int s = 0; s < w->sectors; s++)
+    {
+        sector* sc = &w->sec[s];
+        if(sc->state != SECTOR_LIVE || sectorNear(w, sc->x, sc->y, sc->z) == 1)
+            continue;
+        for(unsigned int i = s*n; i < s*n + n; i++)
+        {
+            gridRemove(w, i);
+            r->free[i] = 1;
+            if(r->sleep[i] != 0)
+            {
+                r->sleep[i] = 0;
+                rockStir(w, i);
+            }
+        }
+        sc->state = SECTOR_EMPTY;
+        w->active_dirty = 1;
+    }
+
+    // ask for the missing ones, slots still loading a far sector free up once it is live
+    unsigned int e = 0;
+    for(int dz = -SECTOR_SPAN; dz <= SECTOR_SPAN; dz++)
+    for(int dy = -SECTOR_SPAN; dy <= SECTOR_SPAN; dy++)
+    for(int dx = -SECTOR_SPAN; dx <= SECTOR_SPAN; dx++)
+    {
+        const int sx = x+dx, sy = y+dy, sz = z+dz;
+        unsigned int s = 0;
+        while(s < w->sectors && (w->sec[s].state == SECTOR_EMPTY || w->sec[s].x != sx || w->sec[s].y != sy || w->sec[s].z != sz))
+            s++;
+        if(s < w->sectors)
+            continue;
+        while(e < w->sectors && w->sec[e].state != SECTOR_EMPTY)
+            e++;
+        if(e == w->sectors)
+        {
+            w->sec_dirty = 1;
+            return;
+        }
+        streamQueue(w, e, sx, sy, sz);
+    }
+}
+
+//*************************************
+// world size & storage
+//*************************************
+int sim_option(const char* opt)
+{
+    if(strncmp(opt, "rocks=", 6) == 0)
+    {
+        const long n = atol(opt+6);
+        ARRAY_MAX = n < 9 ? 9 : n > ROCKS_LIMIT ? ROCKS_LIMIT : n; // at least one of each rock mesh
+        return 1;
+    }
+    if(strncmp(opt, "far=", 4) == 0)
+    {
+        far_setting = fzero(atof(opt+4));
+        return 1;
+    }
+    if(strcmp(opt, "stream") == 0 || strncmp(opt, "stream=", 7) == 0)
+    {
+        sim_stream = opt[6] == '=' ? atoi(opt+7) != 0 : 1;
+        return 1;
+    }
+    if(strncmp(opt, "simd=", 5) == 0)
+    {
+        sim_simd = atoi(opt+5) != 0;
+        return 1;
+    }
+    return 0;
+}
+
+int sim_config(const char* file, int (*option)(const char*))
+{
+    FILE* f = fopen(file, "r");
+    if(f == NULL)
+        return 0;
+    char line[256];
+    while(fgets(line, sizeof(line), f) != NULL)
+    {
+        line[strcspn(line, "\r\n#")] = 0x00;
+        if(line[0] == 0x00)
+            continue;
+        if(option(line) == 0)
+            printf("%s: unknown setting %s\n", file, line);
+    }
+    fclose(f);
+    return 1;
+}
+
+static inline unsigned int gridBuckets()
+{
+    unsigned int b = 1;
+    while(b < ARRAY_MAX*GRID_BUCKETS_PER_ROCK && b < 0x80000000u)
+        b <<= 1;
+    return b;
+}
+
+size_t sim_bytes()
+{
+    const size_t rock = 6*sizeof(int) + 6*sizeof(unsigned int)   // free, sleep, nores, grid links & bucket, grid stamp, hits, mined, active, stirred & relink
+                      + 7*sizeof(f32) + 3*sizeof(vec) + sizeof(uint); // scale, rndf, minerals, pos, lpos, vel, rnd
+    const size_t sectors = sim_stream == 1 ? (2*SECTOR_SPAN+1)*(2*SECTOR_SPAN+1)*(2*SECTOR_SPAN+1) : 1;
+    const size_t runs = ARRAY_MAX/STEP_RUN + 1;
+    return rock*ARRAY_MAX + gridBuckets()*sizeof(int) + sectors*(sizeof(sector) + 2*sizeof(unsigned int)) + runs*(sizeof(unsigned int) + sizeof(f32));
+}
+
+void sim_free(world* w)
+{
+    streamStop();
+    gi* r = &w->rocks;
+    void* p[] = {r->free, r->scale, r->pos, r->lpos, r->vel, r->sleep, r->nores, r->rnd, r->rndf, r->qshield, r->qbreak, r->qslow, r->qrepel, r->qfuel,
+                 w->grid_head, w->grid_next, w->grid_prev, w->grid_bucket, w->grid_stamp, w->grid_hits, w->mined, w->sec, w->loaded, w->active, w->stirred,
+                 w->relink, w->run_relink, w->run_so};
+    for(unsigned int i = 0; i < sizeof(p)/sizeof(void*); i++)
+        free(p[i]);
+    memset(w, 0, sizeof(world));
+}
+
+// the default world is ROCKS_DEFAULT rocks over ROCKS_DEFAULT / 8-12, other
+// rock counts grow or shrink it by the cube root to keep the same density
+static inline f32 farDistance(f32 divisor)
+{
+    if(far_setting > 0.f)
+        return far_setting;
+    const f32 density = ARRAY_MAX == ROCKS_DEFAULT ? 1.f : cbrtf((f32)ARRAY_MAX / (f32)ROCKS_DEFAULT);
+    return (float)ROCKS_DEFAULT / divisor * density;
+}
+
+static void stepKernel();
+int sim_init(world* w)
+{
+    memset(w, 0, sizeof(world));
+    stepKernel();
+
+    // streamed rocks are split evenly between the sector slots, at least one of each rock mesh a sector
+    const unsigned int side = sim_stream == 1 ? 2*SECTOR_SPAN+1 : 1;
+    w->sectors = side*side*side;
+    w->sector_rocks = ARRAY_MAX / w->sectors < 9 ? 9 : ARRAY_MAX / w->sectors;
+    ARRAY_MAX = w->sectors * w->sector_rocks;
+    FAR_DISTANCE = farDistance(FAR_DIVISOR);
+
+    gi* r = &w->rocks;
+    const size_t n = ARRAY_MAX;
+    r->free = malloc(n*sizeof(int));
+    r->scale = malloc(n*sizeof(f32));
+    r->pos = malloc(n*sizeof(vec));
+    r->lpos = malloc(n*sizeof(vec));
+    r->vel = malloc(n*sizeof(vec));
+    r->sleep = malloc(n*sizeof(int));
+    r->nores = malloc(n*sizeof(int));
+    r->rnd = malloc(n*sizeof(uint));
+    r->rndf = malloc(n*sizeof(f32));
+    r->qshield = malloc(n*sizeof(f32));
+    r->qbreak = malloc(n*sizeof(f32));
+    r->qslow = malloc(n*sizeof(f32));
+    r->qrepel = malloc(n*sizeof(f32));
+    r->qfuel = malloc(n*sizeof(f32));
+
+    const unsigned int buckets = gridBuckets();
+    w->grid_mask = buckets-1;
+    w->grid_head = malloc(buckets*sizeof(int));
+    w->grid_next = malloc(n*sizeof(int));
+    w->grid_prev = malloc(n*sizeof(int));
+    w->grid_bucket = malloc(n*sizeof(int));
+    w->grid_stamp = malloc(n*sizeof(unsigned int));
+    w->grid_hits = malloc(n*sizeof(unsigned int));
+    w->mined = malloc(n*sizeof(unsigned int));
+    w->sec = calloc(w->sectors, sizeof(sector));
+    w->loaded = malloc(w->sectors*sizeof(unsigned int));
+    w->active = malloc(n*sizeof(unsigned int));
+    w->stirred = malloc(n*sizeof(unsigned int));
+    w->relink = malloc(n*sizeof(unsigned int));
+    w->run_relink = malloc((n/STEP_RUN + 1)*sizeof(unsigned int));
+    w->run_so = malloc((n/STEP_RUN + 1)*sizeof(f32));
+
+    if(r->free == NULL || r->scale == NULL || r->pos == NULL || r->lpos == NULL || r->vel == NULL || r->sleep == NULL || r->nores == NULL || r->rnd == NULL ||
+       r->rndf == NULL || r->qshield == NULL || r->qbreak == NULL || r->qslow == NULL || r->qrepel == NULL || r->qfuel == NULL ||
+       w->grid_head == NULL || w->grid_next == NULL || w->grid_prev == NULL || w->grid_bucket == NULL || w->grid_stamp == NULL ||
+       w->grid_hits == NULL || w->mined == NULL || w->sec == NULL || w->loaded == NULL || w->active == NULL || w->stirred == NULL ||
+       w->relink == NULL || w->run_relink == NULL || w->run_so == NULL || (w->sectors > 1 && streamStart(w) == 0))
+    {
+        sim_free(w);
+        return 0;
+    }
+    return 1;
+}
+
+void sim_new(world* w, unsigned int seed)
+{
+    w->key = rngKey(seed);
+
+#ifdef __arm__
+    FAR_DISTANCE = farDistance(FAR_DIVISOR);
+#else
+    if(far_setting > 0.f)
+        FAR_DISTANCE = far_setting;
+    else
+    {
+        rng g = rngStream(w->key, ARRAY_MAX, 0);
+        const f32 scalar = rngFloat(&g, 8.f, 12.f);
+        FAR_DISTANCE = farDistance(scalar);
+        printf("Far Distance Divisor: %g\n", scalar);
+    }
+#endif
+
+    w->pp = (vec){0.f, 0.f, 0.f};
+    w->lpp = w->pp;
+    w->pv = (vec){0.f, 0.f, 0.f};
+    w->pd = (vec){0.f, 0.f, 0.f};
+    w->pld = (vec){0.f, 0.f, 0.f};
+
+    w->ct = 0;
+    w->pm = 0;
+    w->so = 0.f;
+    w->sa = 0.f;
+    w->pr = 0.f;
+    w->lpr = 0.f;
+    w->lgr = 0.f;
+
+    w->pf = 1.f;
+    w->pb = 1.f;
+    w->ps = 1.f;
+    w->psl = 0.f;
+    w->pre = 0.f;
+    w->psp = 0.f;
+
+    w->mined_num = 0;
+
+    // the sectors around the start are generated here, the worker must be done with the last world's
+    const int span = w->sectors > 1 ? SECTOR_SPAN : 0;
+    streamWait(streaming.tail);
+    w->sector_size = 2.f*FAR_DISTANCE / (f32)(2*span+1);
+    for(unsigned int s = 0; s < w->sectors; s++)
+    {
+        sector* sc = &w->sec[s];
+        sc->x = (int)(s % (2*span+1)) - span;
+        sc->y = (int)(s / (2*span+1) % (2*span+1)) - span;
+        sc->z = (int)(s / ((2*span+1)*(2*span+1))) - span;
+        sc->key = w->sectors > 1 ? sectorKey(w->key, sc->x, sc->y, sc->z) : w->key;
+        sc->state = SECTOR_LIVE;
+    }
+    w->scx = w->scy = w->scz = 0;
+    w->sec_dirty = 0;
+    w->step = 0;
+    w->loaded_num = 0;
+
+    poolRun(genRocks, w, ARRAY_MAX);
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        w->active[i] = i;
+    w->active_num = ARRAY_MAX;
+    w->active_sorted = ARRAY_MAX;
+    w->active_dirty = 0;
+    w->stirred_num = 0;
+
+    // linking is cheap and order dependent, so it stays on this thread
+    gridReset(w);
+    for(unsigned int i = 0; i < ARRAY_MAX; i++)
+        gridInsert(w, i);
+}
+
+typedef struct
+{
+    const world* w;
+    unsigned int first;
+    f32* colors;
+} colorjob;
+
+// a live rock's colours from its sector key, index in the sector & minerals
+static void genRockColors(uint64_t key, unsigned int k, const f32* q, f32* c)
+{
+    rng g = rngStream(key, k, RNG_COLORS);
+    for(uint j = 0; j < 720; j += 3)
+    {
+        uint set = 0;
+
+        // break
+        if(rngFloat(&g, 0.f, 1.f) < q[1]*CLR_CHANCE)
+        {
+            c[j] = 0.644f;
+            c[j+1] = 0.209f;
+            c[j+2] = 0.f;
+            set = 1;
+        }
+
+        // shield
+        if(set == 0 && rngFloat(&g, 0.f, 1.f) < q[0]*CLR_CHANCE)
+        {
+            c[j] = 0.f;
+            c[j+1] = 0.8f;
+            c[j+2] = 0.28f;
+            set = 1;
+        }
+
+        // slow
+        if(set == 0 && rngFloat(&g, 0.f, 1.f) < q[2]*CLR_CHANCE)
+        {
+            c[j] = 0.429f;
+            c[j+1] = 0.f;
+            c[j+2] = 0.8f;
+            set = 1;
+        }
+
+        // repel
+        if(set == 0 && rngFloat(&g, 0.f, 1.f) < q[3]*CLR_CHANCE)
+        {
+            c[j] = 0.095f;
+            c[j+1] = 0.069f;
+            c[j+2] = 0.041f;
+            set = 1;
+        }
+
+        // fuel
+        if(set == 0 && rngFloat(&g, 0.f, 1.f) < q[4]*CLR_CHANCE)
+        {
+            c[j] = 0.062f;
+            c[j+1] = 1.f;
+            c[j+2] = 0.873f;
+            set = 1;
+        }
+
+        // else
+        if(set == 0)
+        {
+            c[j] = ROCK_DARKNESS;
+            c[j+1] = ROCK_DARKNESS;
+            c[j+2] = ROCK_DARKNESS;
+        }
+    }
+}
+
+
+static void rockDark(f32* c)
+{
+    for(uint j = 0; j < 720; j++)
+        c[j] = ROCK_DARKNESS;
+}
+
+void sim_rock_colors(const world* w, unsigned int i, f32* c)
+{
+    const gi* r = &w->rocks;
+
+    // mined rocks have had their minerals refined out
+    if(r->free[i] != 0)
+    {
+        rockDark(c);
+        return;
+    }
+    const f32 q[5] = {r->qshield[i], r->qbreak[i], r->qslow[i], r->qrepel[i], r->qfuel[i]};
+    genRockColors(w->sec[i / w->sector_rocks].key, i % w->sector_rocks, &q[0], c);
+}
+
+// the same from the key alone, the minerals are drawn again where genRock() drew them
+void sim_key_colors(uint64_t key, unsigned int k, int mined, f32* c)
+{
+    if(mined != 0)
+    {
+        rockDark(c);
+        return;
+    }
+    f32 q[5];
+    rng g = rngStream(key, k, RNG_MINERALS);
+    genMinerals(&g, &q[0]);
+    genRockColors(key, k, &q[0], c);
+}
+
+static void genColors(void* arg, unsigned int start, unsigned int end)
+{
+    const colorjob* job = (const colorjob*)arg;
+    for(unsigned int k = start; k < end; k++)
+        sim_rock_colors(job->w, job->first + k, &job->colors[k*720]);
+}
+
+// colour arrays of rocks first to first+n into colors, 720 floats each
+void sim_colors(const world* w, unsigned int first, unsigned int n, f32* colors)
+{
+    colorjob job = {w, first, colors};
+    poolRun(genColors, &job, n);
+}
+
+//*************************************
+// simulation step
+//*************************************
+// one active rock, sleeping rocks are not in the runs
+static inline void stepRock(world* w, unsigned int i, f32 dt, unsigned int* relink, unsigned int* n, f32* so)
+{
+    gi* r = &w->rocks;
+    r->lpos[i] = r->pos[i];
+    vec inc;
+    vMulS(&inc, r->vel[i], dt);
+    vAdd(&r->pos[i], r->pos[i], inc);
+
+    if(r->free[i] == 2)
+    {
+        r->scale[i] -= 32.f*dt;
+        if(r->scale[i] <= 0.f)
+        {
+            r->free[i] = 1;
+            relink[(*n)++] = i;
+            return;
+        }
+    }
+    if((int)gridBucket(w, r->pos[i]) != w->grid_bucket[i])
+        relink[(*n)++] = i;
+
+    const f32 reach = 10.f + r->scale[i];
+    if(fabsf(r->pos[i].x - w->pp.x) < reach && vDistSq(w->pp, r->pos[i]) < reach*reach)
+    {
+        const f32 dist = vDist(w->pp, r->pos[i]);
+        if(dist < reach && (*so == 0.f || dist < *so)){*so = dist;}
+    }
+}
+
+// run c of the active rocks, a run only writes its own rocks & slots so the grid is left
+// to the caller, in run order, and the world is the same for any thread count
+static void stepRunScalar(world* w, unsigned int c, f32 dt)
+{
+    const unsigned int first = c*STEP_RUN;
+    const unsigned int last = first+STEP_RUN < w->active_num ? first+STEP_RUN : w->active_num;
+    unsigned int n = 0;
+    f32 so = 0.f;
+    for(unsigned int k = first; k < last; k++)
+        stepRock(w, w->active[k], dt, &w->relink[first], &n, &so);
+    w->run_relink[c] = n;
+    w->run_so[c] = so;
+}
+
+#if defined(__GNUC__) && defined(__has_builtin) && !defined(SIM_SCALAR)
+#if __has_builtin(__builtin_shufflevector) && __has_builtin(__builtin_convertvector)
+    #define SIM_LANES 4
+#endif
+#endif
+
+#ifdef SIM_LANES
+// the same run 4 rocks at a time with GCC vector extensions, rocks in consecutive slots (most of
+// them, sim_step() compacts active back into slot order before the runs) move as 4 whole vecs &
+// are tested for a new grid bucket & the shield across the lanes, only lanes that hit something
+// go back through stepRock() in order, a lane is a vec so 8 lanes under AVX2 would spend what
+// they save on crossing 128 bit halves
+typedef float svf __attribute__((vector_size(16)));
+typedef int svi __attribute__((vector_size(16)));
+typedef unsigned int svu __attribute__((vector_size(16)));
+
+// gridCell() of 4 lanes
+static inline __attribute__((always_inline)) void stepCell(svu* r, const svf* f)
+{
+    const svf t = *f * RECIP_GRID_CELL;
+    const svi i = __builtin_convertvector(t, svi);
+    *r = (svu)(i + (__builtin_convertvector(i, svf) > t)); // truncated to floored, true is -1
+}
+
+static inline __attribute__((always_inline)) void stepLanes(world* w, unsigned int c, f32 dt)
+{
+    gi* r = &w->rocks;
+    const unsigned int first = c*STEP_RUN;
+    const unsigned int last = first+STEP_RUN < w->active_num ? first+STEP_RUN : w->active_num;
+    unsigned int* relink = &w->relink[first];
+    unsigned int n = 0;
+    f32 so = 0.f;
+    const svi keepw = {0, 0, 0, -1}; // vAdd() leaves w alone
+
+    unsigned int k = first;
+    for(; k + 4 <= last; k += 4)
+    {
+        const unsigned int* a = &w->active[k];
+        const unsigned int i0 = a[0];
+        if(a[1] != i0+1 || a[2] != i0+2 || a[3] != i0+3) // mined & sleeping rocks leave gaps
+        {
+            for(int l = 0; l < 4; l++)
+                stepRock(w, a[l], dt, relink, &n, &so);
+            continue;
+        }
+
+        // a rock to a vector, xyzw
+        svf p[4], v[4];
+        memcpy(&p[0], &r->pos[i0], sizeof(p));
+        memcpy(&v[0], &r->vel[i0], sizeof(v));
+        memcpy(&r->lpos[i0], &p[0], sizeof(p));
+        for(int j = 0; j < 4; j++)
+        {
+            const svf m = p[j] + v[j]*dt;
+            p[j] = (svf)(((svi)p[j] & keepw) | ((svi)m & ~keepw));
+        }
+        memcpy(&r->pos[i0], &p[0], sizeof(p));
+
+        // to one axis a vector, x0 x1 y0 y1 & x2 x3 y2 y3 to x0 x1 x2 x3 & y0 y1 y2 y3
+        const svf ab = __builtin_shufflevector(p[0], p[1], 0, 4, 1, 5);
+        const svf cd = __builtin_shufflevector(p[2], p[3], 0, 4, 1, 5);
+        const svf abz = __builtin_shufflevector(p[0], p[1], 2, 6, 3, 7);
+        const svf cdz = __builtin_shufflevector(p[2], p[3], 2, 6, 3, 7);
+        const svf px = __builtin_shufflevector(ab, cd, 0, 1, 4, 5);
+        const svf py = __builtin_shufflevector(ab, cd, 2, 3, 6, 7);
+        const svf pz = __builtin_shufflevector(abz, cdz, 0, 1, 4, 5);
+
+        svf sc;
+        svi fr, gb;
+        memcpy(&sc, &r->scale[i0], sizeof(sc));
+        memcpy(&fr, &r->free[i0], sizeof(fr));
+        memcpy(&gb, &w->grid_bucket[i0], sizeof(gb));
+
+        svu cx, cy, cz;
+        stepCell(&cx, &px), stepCell(&cy, &py), stepCell(&cz, &pz);
+        const svu b = (cx * 73856093u ^ cy * 19349663u ^ cz * 83492791u) & w->grid_mask;
+        const svi moved = (svi)b != gb;
+        const svf dx = w->pp.x - px, dy = w->pp.y - py, dz = w->pp.z - pz;
+        const svf dsq = dx*dx + dy*dy + dz*dz;
+        const svf reach = sc + 10.f;
+        const svi touch = dsq < reach*reach;
+        const svi shrink = fr == 2;
+
+        const svi any = moved | touch | shrink;
+        int hit = 0;
+        for(int l = 0; l < 4; l++)
+            hit |= any[l];
+        if(hit == 0)
+            continue;
+        for(int l = 0; l < 4; l++)
+        {
+            const unsigned int i = i0 + l;
+            if(shrink[l] != 0)
+            {
+                // shrinking away, rare enough to redo the lane on its own
+                r->pos[i] = r->lpos[i];
+                stepRock(w, i, dt, relink, &n, &so);
+                continue;
+            }
+            if(moved[l] != 0)
+                relink[n++] = i;
+            if(touch[l] != 0)
+            {
+                const f32 dist = sqrtps(dsq[l]);
+                if(dist < reach[l] && (so == 0.f || dist < so)){so = dist;}
+            }
+        }
+    }
+    for(; k < last; k++)
+        stepRock(w, w->active[k], dt, relink, &n, &so);
+    w->run_relink[c] = n;
+    w->run_so[c] = so;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("avx2"))) static void stepRunAVX2(world* w, unsigned int c, f32 dt){stepLanes(w, c, dt);}
+__attribute__((target("sse4.1"))) static void stepRunSSE4(world* w, unsigned int c, f32 dt){stepLanes(w, c, dt);}
+#endif
+#ifdef CPU_NEON_TARGET
+__attribute__((target("fpu=neon"))) static void stepRunNEON(world* w, unsigned int c, f32 dt){stepLanes(w, c, dt);} // 32-bit ARM builds for VFP only
+#endif
+static void stepRunVector(world* w, unsigned int c, f32 dt){stepLanes(w, c, dt);} // SSE2 on x86, NEON on aarch64
+#endif
+
+// picked once by sim_init(), the widest the CPU has unless simd=0
+typedef void (*steprun)(world* w, unsigned int c, f32 dt);
+steprun step_run = stepRunScalar;
+const char* step_kernel = "scalar";
+
+static void stepKernel()
+{
+    step_run = stepRunScalar;
+    step_kernel = "scalar";
+    if(sim_simd == 0)
+        return;
+#ifdef SIM_LANES
+    step_run = stepRunVector;
+    step_kernel = "vector";
+#if defined(__x86_64__) || defined(__i386__)
+    if(cpuFeatures() & CPU_AVX2)
+    {
+        step_run = stepRunAVX2;
+        step_kernel = "avx2";
+    }
+    else if(cpuFeatures() & CPU_SSE41)
+    {
+        step_run = stepRunSSE4;
+        step_kernel = "sse4";
+    }
+#elif defined(CPU_NEON_TARGET)
+    if(cpuFeatures() & CPU_NEON)
+    {
+        step_run = stepRunNEON;
+        step_kernel = "neon";
+    }
+#endif
+#endif
+}
+
+typedef struct
+{
+    world* w;
+    f32 dt;
+} stepjob;
+
+static void stepRocks(void* arg, unsigned int start, unsigned int end)
+{
+    const stepjob* job = (const stepjob*)arg;
+    for(unsigned int c = start; c < end; c++)
+        step_run(job->w, c, job->dt);
+}
+
+void sim_step(world* w, input* in, f32 dt)
+{
+    gi* r = &w->rocks;
+
+    w->lpp = w->pp;
+    w->lpr = w->pr;
+
+    // keystates
+    if(w->pf == 0.f) // disable thrust control on fuel empty
+        memset(&in->keys[0], 0x00, sizeof(uint)*6);
+
+    if(in->keys[0] == 1)
+    {
+        w->pr += 3.f * dt;
+        w->lgr = w->pr;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    if(in->keys[1] == 1)
+    {
+        w->pr -= 3.f * dt;
+        w->lgr = w->pr;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    if(in->keys[2] == 1)
+    {
+        w->ct = 1;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    if(in->keys[3] == 1)
+    {
+        w->ct = 2;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    if(in->keys[4] == 1)
+    {
+        w->pv.y -= THRUST_POWER * dt;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    if(in->keys[5] == 1)
+    {
+        w->pv.y += THRUST_POWER * dt;
+        w->pf -= FUEL_DRAIN_RATE * dt;
+        w->pf = fzero(w->pf);
+    }
+
+    // increment player direction
+    if(w->ct > 0)
+    {
+        vec inc;
+        if(w->ct == 1)
+            vMulS(&inc, w->pd, THRUST_POWER * dt);
+        else if(w->ct == 2)
+            vMulS(&inc, w->pd, -THRUST_POWER * dt);
+        vAdd(&w->pv, w->pv, inc);
+    }
+    vAdd(&w->pp, w->pp, w->pv); // pv is per step, steps are a fixed SIM_DT
+
+    // new player direction, thrust takes it up on the next step
+    w->pld = (vec){-sinf(w->pr), 0.f, -cosf(w->pr), w->pld.w};
+    if(w->ct > 0)
+    {
+        w->pd = w->pld;
+        w->ct = 0;
+    }
+
+    // the head follows the camera until it would turn past the neck
+    w->pfd = (vec){-sinf(in->xrot), 0.f, -cosf(in->xrot), w->pfd.w};
+    if(vDot(w->pfd, w->pld) >= NECK_ANGLE)
+        w->lgr = in->xrot;
+
+    w->psp = vMag(w->pv);
+
+    if(w->sectors > 1)
+        streamStep(w);
+
+    // shield, or fuel once the shield is gone, drains while touching a rock
+    w->sa = 0.f;
+    if(w->so > 0.f)
+    {
+        const f32 ss = 1.f-(w->so*RECIP_MAX_ROCK_SCALE);
+        if(w->ps == 0.f)
+        {
+            w->pf -= FUEL_DRAIN_RATE * ss * dt;
+            w->pf = fzero(w->pf);
+        }
+        else
+        {
+            w->ps -= SHIELD_DRAIN_RATE * ss * dt;
+            w->ps = fzero(w->ps);
+            w->sa = fsat(ss);
+        }
+    }
+
+    // rocks, the ones a dropped sector took are still listed until the compaction
+    if(w->active_dirty == 1)
+        activeCompact(w);
+    const unsigned int runs = (w->active_num + STEP_RUN-1) / STEP_RUN;
+    stepjob job = {w, dt};
+    poolRun(stepRocks, &job, runs);
+
+    // the grid & the shield minimum from each run, shield on is the closest rock touching the player
+    w->so = 0.f;
+    for(unsigned int c = 0; c < runs; c++)
+    {
+        const unsigned int* relink = &w->relink[c*STEP_RUN];
+        for(unsigned int k = 0; k < w->run_relink[c]; k++)
+        {
+            const unsigned int i = relink[k];
+            gridRemove(w, i);
+            if(r->free[i] == 1)
+                w->active_dirty = 1;
+            else
+                gridInsert(w, i);
+        }
+        const f32 so = w->run_so[c];
+        if(so > 0.f && (w->so == 0.f || so < w->so)){w->so = so;}
+    }
+    if(w->active_dirty == 1)
+        activeCompact(w);
+
+    // sleeping rocks are not in a run but still touch the player
+    const unsigned int n = gridNear(w, w->pp, 10.f + MAX_ROCK_SCALE);
+    for(unsigned int k = 0; k < n; k++)
+    {
+        const unsigned int i = w->grid_hits[k];
+        if(r->sleep[i] == 0)
+            continue;
+        const f32 dist = vDist(w->pp, r->pos[i]);
+        if(dist < 10.f + r->scale[i])
+            if(w->so == 0.f || dist < w->so){w->so = dist;}
+    }
+}
+
+//*************************************
+// player actions
+//*************************************
+// break & refine every rock within reach
+void sim_break(world* w)
+{
+    gi* r = &w->rocks;
+    if(w->pb <= 0.f)
+        return;
+
+    const unsigned int n = gridNear(w, w->pp, 30.f + MAX_ROCK_SCALE);
+    for(unsigned int k = 0; k < n; k++)
+    {
+        const unsigned int i = w->grid_hits[k];
+        if(r->free[i] == 0)
+        {
+            const f32 dist = vDist(w->pp, r->pos[i]);
+            if(dist < 30.f + r->scale[i])
+            {
+                w->pb -= 0.06f;
+                w->pb = fzero(w->pb); // hack, yes user could mine beyond pb == 0.f in this loop, take it as a last chance
+
+                w->pf += r->qfuel[i] * REFINARY_YEILD * 3.f;
+                w->pb += r->qbreak[i] * REFINARY_YEILD;
+                w->ps += r->qshield[i] * REFINARY_YEILD;
+                w->psl += r->qslow[i] * REFINARY_YEILD;
+                w->pre += r->qrepel[i] * REFINARY_YEILD;
+
+                w->pf = fone(w->pf);
+                w->pb = fone(w->pb);
+                w->ps = fone(w->ps);
+                w->psl = fone(w->psl);
+                w->pre = fone(w->pre);
+
+                r->free[i] = 2;
+                rockWake(w, i); // it shrinks away over the next steps
+                w->mined[w->mined_num++] = i;
+                w->pm++;
+
+                char strts[16];
+                timestamp(&strts[0]);
+                printf("[%s] Break %.2f - Shield %.2f - Stop %.2f - Repel %.2f\n", strts, w->pb, w->ps, w->psl, w->pre);
+                printf("[%s] Mined: %u\n", strts, w->pm);
+            }
+        }
+    }
+}
+
+// push every rock within reach the way the player is facing
+void sim_repel(world* w)
+{
+    gi* r = &w->rocks;
+    if(w->pre <= 0.f)
+        return;
+
+    const unsigned int n = gridNear(w, w->pp, 30.f + MAX_ROCK_SCALE);
+    for(unsigned int k = 0; k < n; k++)
+    {
+        const unsigned int i = w->grid_hits[k];
+        if(r->free[i] == 0)
+        {
+            const f32 dist = vDist(w->pp, r->pos[i]);
+            if(dist < 30.f + r->scale[i])
+            {
+                //vRuv(&r->vel[i]);
+                w->pre -= 0.06f;
+                if(w->pre <= 0.f)
+                {
+                    w->pre = 0.f;
+                    break;
+                }
+                r->vel[i] = w->pfd;
+                vMulS(&r->vel[i], r->vel[i], 42.f);
+                rockWake(w, i);
+
+                char strts[16];
+                timestamp(&strts[0]);
+                printf("[%s] Repel %.2f\n", strts, w->pre);
+            }
+        }
+    }
+}
+
+// stop every rock in sight
+void sim_stop(world* w)
+{
+    gi* r = &w->rocks;
+    if(w->psl <= 0.f)
+        return;
+
+    const unsigned int n = gridNear(w, w->pp, 333.f + MAX_ROCK_SCALE);
+    for(unsigned int k = 0; k < n; k++)
+    {
+        const unsigned int i = w->grid_hits[k];
+        if(r->free[i] == 0 && r->rndf[i] != 0.f)
+        {
+            const f32 dist = vDist(w->pp, r->pos[i]);
+            if(dist < 333.f + r->scale[i])
+            {
+                w->psl -= 0.06f;
+                if(w->psl <= 0.f)
+                {
+                    w->psl = 0.f;
+                    break;
+                }
+                r->vel[i] = (vec){0.f, 0.f, 0.f};
+                r->rndf[i] = 0.f;
+                rockSleep(w, i);
+
+                char strts[16];
+                timestamp(&strts[0]);
+                printf("[%s] Stop %.2f\n", strts, w->psl);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,246 @@
+/*
+    World snapshots for a renderer on another thread.
+
+    snapPublish() copies what the renderer reads out of a world into the
+    back snapshot and hands it over with one atomic exchange, snapTake()
+    swaps the newest one in with another, the hand over never waits. It
+    takes three snapshots, the one being written, the one being drawn
+    and the newest published one between them, a snapshot the renderer
+    never took is written over.
+
+    What has to reach the renderer in order, rocks mined, sector slots
+    loaded, rocks falling asleep or waking and new games, can't be
+    skipped with a snapshot, so world.mined, loaded & stirred become
+    events on a ring and each snapshot says how far into it it is,
+    snapNext() hands them out up to the snapshot taken. The ring holds
+    the most one publish can have, a sim thread that gets more than that
+    ahead of the renderer waits, the only place it does, snapWaited()
+    is how long it has in total.
+
+    The renderer makes rock colour arrays from each snapshot's sector
+    keys with sim_key_colors(), rocks mined & shrinking away are flagged
+    SNAP_SPENT, so it never reads the world.
+*/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "sim.h"
+
+#define SNAP_FLOATS 10  // a rock: last position xyz, position xyz, scale, spin seed, spin rate, speed
+#define SNAP_ASLEEP 1   // rock & event flags
+#define SNAP_NORES  2
+#define SNAP_FRESH  4   // on snap_mid, published & not taken yet
+#define SNAP_SPENT  8   // rock flag, mined & shrinking away
+
+enum {SNAP_MINED, SNAP_LOADED, SNAP_STIRRED, SNAP_NEWGAME};
+
+typedef struct
+{
+    unsigned int i;             // rock, sector slot or seed
+    unsigned char kind, flag;
+    vec p;                      // SNAP_STIRRED, where the rock is with its scale in w
+} snapevent;
+
+typedef struct
+{
+    // rocks in world.active order
+    unsigned int num;
+    unsigned int* id;
+    f32* rock;                  // SNAP_FLOATS a rock
+    unsigned char* flag;
+    uint64_t* key;              // per sector slot, what its rocks' colours are made from
+
+    // player, what is drawn & shown in the title
+    vec pp, lpp;
+    f32 pr, lpr, lgr, sa, psp, pf, pb, ps, psl, pre;
+    uint pm;
+
+    double t;                   // published at
+    double acc;                 // step time left over at t
+    unsigned long long events;  // events written before it
+    unsigned long long inputs;  // caller's count of inputs acted on before it
+} snapshot;
+
+int  snapInit(unsigned int rocks, unsigned int sectors); // 0 if out of memory
+size_t snapBytes();
+void snapFree();
+double snapWaited();            // seconds the sim thread waited on the renderer
+void snapEvent(unsigned int kind, unsigned int i, unsigned int flag, vec p); // sim thread
+void snapPublish(world* w, double t, double acc, unsigned long long inputs); // sim thread, w's mined, loaded & stirred lists become events & are emptied
+const snapshot* snapTake();     // render thread, the newest snapshot
+int  snapNext(const snapshot* s, snapevent* e); // render thread, the next event up to s, 0 when there are none
+
+//*************************************
+// implementation
+//*************************************
+snapshot snaps[3];
+unsigned int snap_back = 0, snap_front = 1;
+unsigned int snap_mid = 2;      // exchanged by both threads
+size_t snap_bytes = 0;
+
+snapevent* snap_ring;
+unsigned long long snap_size;
+unsigned int snap_sectors;
+unsigned long long snap_head = 0; // written, sim thread
+unsigned long long snap_tail = 0; // read, render thread
+double snap_waited = 0;         // sim thread
+
+int snapInit(unsigned int rocks, unsigned int sectors)
+{
+    // one publish is at most every rock mined & stirred, every slot loaded and a new game
+    snap_size = 2ULL*rocks + sectors + 1;
+    snap_sectors = sectors;
+    snap_ring = malloc(snap_size*sizeof(snapevent));
+    snap_bytes = snap_size*sizeof(snapevent) + 3*((size_t)rocks*(sizeof(unsigned int) + SNAP_FLOATS*sizeof(f32) + 1) + sectors*sizeof(uint64_t));
+    if(snap_ring == NULL)
+        return 0;
+    for(unsigned int b = 0; b < 3; b++)
+    {
+        snapshot* s = &snaps[b];
+        memset(s, 0, sizeof(snapshot));
+        s->id = malloc(rocks*sizeof(unsigned int));
+        s->rock = malloc((size_t)rocks*SNAP_FLOATS*sizeof(f32));
+        s->flag = malloc(rocks);
+        s->key = malloc(sectors*sizeof(uint64_t));
+        if(s->id == NULL || s->rock == NULL || s->flag == NULL || s->key == NULL)
+            return 0;
+    }
+    return 1;
+}
+
+size_t snapBytes()
+{
+    return snap_bytes;
+}
+
+void snapFree()
+{
+    for(unsigned int b = 0; b < 3; b++)
+    {
+        free(snaps[b].id);
+        free(snaps[b].rock);
+        free(snaps[b].flag);
+        free(snaps[b].key);
+    }
+    free(snap_ring);
+}
+
+double snapWaited()
+{
+    return snap_waited;
+}
+
+void snapEvent(unsigned int kind, unsigned int i, unsigned int flag, vec p)
+{
+    if(snap_head - __atomic_load_n(&snap_tail, __ATOMIC_ACQUIRE) >= snap_size)
+    {
+        struct timespec a, b;
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        while(snap_head - __atomic_load_n(&snap_tail, __ATOMIC_ACQUIRE) >= snap_size)
+            usleep(1000); // the renderer is a whole publish behind
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        snap_waited += (double)(b.tv_sec - a.tv_sec) + (double)(b.tv_nsec - a.tv_nsec) * 1e-9;
+    }
+    snapevent* e = &snap_ring[snap_head % snap_size];
+    e->i = i;
+    e->kind = kind;
+    e->flag = flag;
+    e->p = p;
+    snap_head++;
+}
+
+static void snapDrain(world* w)
+{
+    const gi* r = &w->rocks;
+    const vec none = {0};
+    for(unsigned int k = 0; k < w->mined_num; k++)
+        snapEvent(SNAP_MINED, w->mined[k], 0, none);
+    for(unsigned int k = 0; k < w->loaded_num; k++)
+        snapEvent(SNAP_LOADED, w->loaded[k], 0, none);
+    for(unsigned int k = 0; k < w->stirred_num; k++)
+    {
+        const unsigned int i = w->stirred[k];
+        vec p = r->pos[i];
+        p.w = r->scale[i];
+        snapEvent(SNAP_STIRRED, i, (r->sleep[i] != 0 && r->free[i] == 0 ? SNAP_ASLEEP : 0) | (r->nores[i] != 0 ? SNAP_NORES : 0), p);
+    }
+    w->mined_num = 0;
+    w->loaded_num = 0;
+    w->stirred_num = 0;
+}
+
+typedef struct
+{
+    const world* w;
+    snapshot* s;
+} snapjob;
+
+static void snapRocks(void* arg, unsigned int start, unsigned int end)
+{
+    const world* w = ((const snapjob*)arg)->w;
+    snapshot* s = ((const snapjob*)arg)->s;
+    const gi* r = &w->rocks;
+    for(unsigned int c = start; c < end; c++)
+    {
+        const unsigned int last = (c+1)*STEP_RUN < w->active_num ? (c+1)*STEP_RUN : w->active_num;
+        for(unsigned int k = c*STEP_RUN; k < last; k++)
+        {
+            const unsigned int i = w->active[k];
+            f32* d = &s->rock[k*SNAP_FLOATS];
+            d[0] = r->lpos[i].x;
+            d[1] = r->lpos[i].y;
+            d[2] = r->lpos[i].z;
+            d[3] = r->pos[i].x;
+            d[4] = r->pos[i].y;
+            d[5] = r->pos[i].z;
+            d[6] = r->scale[i];
+            d[7] = (f32)r->rnd[i];
+            d[8] = r->rndf[i];
+            d[9] = vMag(r->vel[i]);
+            s->id[k] = i;
+            s->flag[k] = (r->sleep[i] != 0 ? SNAP_ASLEEP : 0) | (r->nores[i] != 0 ? SNAP_NORES : 0) | (r->free[i] != 0 ? SNAP_SPENT : 0);
+        }
+    }
+}
+
+void snapPublish(world* w, double t, double acc, unsigned long long inputs)
+{
+    snapDrain(w);
+
+    snapshot* s = &snaps[snap_back];
+    snapjob job = {w, s};
+    poolRun(snapRocks, &job, (w->active_num + STEP_RUN-1) / STEP_RUN);
+    s->num = w->active_num;
+    for(unsigned int k = 0; k < snap_sectors; k++)
+        s->key[k] = w->sec[k].key;
+
+    s->pp = w->pp, s->lpp = w->lpp;
+    s->pr = w->pr, s->lpr = w->lpr, s->lgr = w->lgr, s->sa = w->sa;
+    s->psp = w->psp, s->pf = w->pf, s->pb = w->pb, s->ps = w->ps, s->psl = w->psl, s->pre = w->pre;
+    s->pm = w->pm;
+    s->t = t;
+    s->acc = acc;
+    s->events = snap_head;
+    s->inputs = inputs;
+
+    snap_back = __atomic_exchange_n(&snap_mid, snap_back | SNAP_FRESH, __ATOMIC_ACQ_REL) & 3;
+}
+
+const snapshot* snapTake()
+{
+    if((__atomic_load_n(&snap_mid, __ATOMIC_ACQUIRE) & SNAP_FRESH) != 0)
+        snap_front = __atomic_exchange_n(&snap_mid, snap_front, __ATOMIC_ACQ_REL) & 3;
+    return &snaps[snap_front];
+}
+
+int snapNext(const snapshot* s, snapevent* e)
+{
+    if(snap_tail == s->events)
+        return 0;
+    *e = snap_ring[snap_tail % snap_size];
+    __atomic_store_n(&snap_tail, snap_tail+1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+#endif
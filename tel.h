@@ -0,0 +1,172 @@
+/*
+    Frame-time telemetry.
+
+    Keeps the last TEL_FRAMES frames in a ring buffer, each frame split
+    into phases. A frame is telFrame(), then telMark(phase) as each phase
+    ends, then telEnd(). Time between two marks goes to the later phase.
+
+    telReport() prints p50, p95, p99 and max of every phase and of the
+    whole frame, telCSV() writes the buffer out one frame per row.
+
+    telLatency() keeps the last TEL_INPUTS input latencies, from when an
+    input happened to the start of the first frame drawn with its effect,
+    telReport() prints their percentiles too.
+*/
+
+#ifndef TEL_H
+#define TEL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TEL_FRAMES 4096 // ~68 seconds at 60 fps
+#define TEL_INPUTS 1024
+
+enum {TEL_INPUT, TEL_SIM, TEL_ROCKS, TEL_PLAYER, TEL_SWAP, TEL_PHASES};
+const char* tel_names[TEL_PHASES] = {"input", "sim", "rocks", "player", "swap"};
+
+typedef struct
+{
+    float ms[TEL_PHASES];
+    float total;
+} telframe;
+
+void telFrame();
+void telMark(unsigned int phase);
+void telEnd();
+void telStats(unsigned int phase, float* p); // p50, p95, p99, max, TEL_PHASES = whole frame
+void telLatency(float ms);
+void telLatencyStats(float* p); // p50, p95, p99, max
+void telReport();
+int  telCSV(const char* file);
+
+//*************************************
+// implementation
+//*************************************
+telframe tel_ring[TEL_FRAMES];
+unsigned long long tel_count = 0; // frames ever ended
+float tel_lat[TEL_INPUTS];
+unsigned long long tel_lat_count = 0; // inputs ever timed
+telframe tel_cur;
+double tel_start, tel_last;
+
+static inline double telNow()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+void telFrame()
+{
+    memset(&tel_cur, 0, sizeof(telframe));
+    tel_start = telNow();
+    tel_last = tel_start;
+}
+
+void telMark(unsigned int phase)
+{
+    const double n = telNow();
+    tel_cur.ms[phase] += (n - tel_last) * 1e3;
+    tel_last = n;
+}
+
+void telEnd()
+{
+    tel_cur.total = (telNow() - tel_start) * 1e3;
+    tel_ring[tel_count % TEL_FRAMES] = tel_cur;
+    tel_count++;
+}
+
+static int telCmp(const void* a, const void* b)
+{
+    const float x = *(const float*)a, y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+static void telPercentiles(float* v, unsigned int n, float* p)
+{
+    if(n == 0)
+    {
+        p[0] = p[1] = p[2] = p[3] = 0.f;
+        return;
+    }
+    qsort(v, n, sizeof(float), telCmp);
+    p[0] = v[(n-1)*50/100];
+    p[1] = v[(n-1)*95/100];
+    p[2] = v[(n-1)*99/100];
+    p[3] = v[n-1];
+}
+
+// p50, p95, p99 & max of one column, phase TEL_PHASES is the frame total
+void telStats(unsigned int phase, float* p)
+{
+    static float v[TEL_FRAMES];
+    const unsigned int n = tel_count < TEL_FRAMES ? tel_count : TEL_FRAMES;
+    for(unsigned int i = 0; i < n; i++)
+        v[i] = phase == TEL_PHASES ? tel_ring[i].total : tel_ring[i].ms[phase];
+    telPercentiles(v, n, p);
+}
+
+void telLatency(float ms)
+{
+    tel_lat[tel_lat_count % TEL_INPUTS] = ms;
+    tel_lat_count++;
+}
+
+void telLatencyStats(float* p)
+{
+    static float v[TEL_INPUTS];
+    const unsigned int n = tel_lat_count < TEL_INPUTS ? tel_lat_count : TEL_INPUTS;
+    memcpy(v, tel_lat, n*sizeof(float));
+    telPercentiles(v, n, p);
+}
+
+void telReport()
+{
+    const unsigned int n = tel_count < TEL_FRAMES ? tel_count : TEL_FRAMES;
+    if(n == 0)
+        return;
+    printf("frame times over the last %u frames (ms)\n", n);
+    printf("phase       p50      p95      p99      max\n");
+    for(unsigned int i = 0; i <= TEL_PHASES; i++)
+    {
+        float p[4];
+        telStats(i, &p[0]);
+        printf("%-7s %8.3f %8.3f %8.3f %8.3f\n", i == TEL_PHASES ? "frame" : tel_names[i], p[0], p[1], p[2], p[3]);
+    }
+    const unsigned int l = tel_lat_count < TEL_INPUTS ? tel_lat_count : TEL_INPUTS;
+    if(l == 0)
+        return;
+    float p[4];
+    telLatencyStats(&p[0]);
+    printf("input to frame over the last %u inputs (ms)\n", l);
+    printf("%-7s %8.3f %8.3f %8.3f %8.3f\n", "latency", p[0], p[1], p[2], p[3]);
+}
+
+// oldest frame first, returns 0 if the file could not be written
+int telCSV(const char* file)
+{
+    FILE* f = fopen(file, "w");
+    if(f == NULL)
+        return 0;
+    fprintf(f, "frame");
+    for(unsigned int i = 0; i < TEL_PHASES; i++)
+        fprintf(f, ",%s_ms", tel_names[i]);
+    fprintf(f, ",total_ms\n");
+    const unsigned long long first = tel_count > TEL_FRAMES ? tel_count - TEL_FRAMES : 0;
+    for(unsigned long long k = first; k < tel_count; k++)
+    {
+        const telframe* fr = &tel_ring[k % TEL_FRAMES];
+        fprintf(f, "%llu", k);
+        for(unsigned int i = 0; i < TEL_PHASES; i++)
+            fprintf(f, ",%.4f", fr->ms[i]);
+        fprintf(f, ",%.4f\n", fr->total);
+    }
+    fclose(f);
+    return 1;
+}
+
+#endif
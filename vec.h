@@ -12,6 +12,9 @@
 #include <string.h>
 
 // #define NOSSE
+#if !defined(__x86_64__) && !defined(__i386__) && !defined(NOSSE)
+    #define NOSSE // the intrinsics below are x86 only, elsewhere they are plain sqrtf()
+#endif
 #if !defined(__linux__) || defined(NOSSE)
     #define SEIR_RAND
 #endif